@@ -6,11 +6,20 @@ class IDisplay {
 public:
     virtual ~IDisplay() = default;
 
+    virtual int16_t width() const = 0;
+    virtual int16_t height() const = 0;
+
     virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
     virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) = 0;
     virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) = 0;
     virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) = 0;
 
+    // Bulk RGB565 blits: one call per run/row/block instead of one per pixel.
+    // drawSpan clips to the panel; drawRow expects width() colors.
+    virtual void drawSpan(int16_t x, int16_t y, const uint16_t* colors, int16_t w) = 0;
+    virtual void drawRow(int16_t y, const uint16_t* colors) = 0;
+    virtual void drawBitmap565(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) = 0;
+
     virtual void fillScreen(uint16_t color) = 0;
     virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) = 0;
     virtual void clearScreen() = 0;
@@ -22,4 +31,20 @@ public:
     virtual void setTextSize(uint8_t size) = 0;
 
     virtual uint16_t color565(uint8_t r, uint8_t g, uint8_t b) = 0;
+
+    // Make everything drawn since the last flip visible at once. Displays that
+    // draw straight to the screen have nothing to swap.
+    virtual void flip() {}
+    virtual uint8_t bufferCount() const { return 1; }
+
+    // Split a row on a transparent key color and emit each opaque run as one span.
+    void drawSpanKeyed(int16_t x, int16_t y, const uint16_t* colors, int16_t w, uint16_t key) {
+        int16_t i = 0;
+        while (i < w) {
+            while (i < w && colors[i] == key) i++;
+            int16_t runStart = i;
+            while (i < w && colors[i] != key) i++;
+            if (i > runStart) drawSpan(x + runStart, y, colors + runStart, i - runStart);
+        }
+    }
 };
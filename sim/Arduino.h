@@ -1,11 +1,16 @@
 #pragma once
 
+#include <cstdarg>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cmath>
+#include <atomic>
 #include <chrono>
 #include <thread>
 
+#include "WString.h"
+
 using std::size_t;
 using byte = uint8_t;
 
@@ -13,17 +18,49 @@ using byte = uint8_t;
 #define PROGMEM
 #endif
 
+#ifndef pgm_read_byte
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#endif
+
 #ifndef pgm_read_word
 #define pgm_read_word(addr) (*(addr))
 #endif
 
+// Host-only virtual clock. Once set, millis()/micros() report virtual time
+// that moves only when the program advances it (or calls delay()), so a
+// render is reproducible and runs as fast as the host allows.
+// useRealTime() returns to the steady clock.
+namespace SimClock {
+    inline std::atomic<int64_t> virtualUs{-1};
+
+    inline bool isVirtual() { return virtualUs >= 0; }
+    inline void setUs(int64_t us) { virtualUs = us; }
+    inline void setMs(uint32_t ms) { virtualUs = (int64_t)ms * 1000; }
+    inline void advanceUs(int64_t us) { virtualUs += us; }
+    inline void useRealTime() { virtualUs = -1; }
+}
+
 inline uint32_t millis() {
+    int64_t now = SimClock::virtualUs;
+    if (now >= 0) return static_cast<uint32_t>(now / 1000);
     static const auto start = std::chrono::steady_clock::now();
-    auto now = std::chrono::steady_clock::now();
-    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count());
+    auto real = std::chrono::steady_clock::now();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(real - start).count());
+}
+
+inline uint32_t micros() {
+    int64_t now = SimClock::virtualUs;
+    if (now >= 0) return static_cast<uint32_t>(now);
+    static const auto start = std::chrono::steady_clock::now();
+    auto real = std::chrono::steady_clock::now();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(real - start).count());
 }
 
 inline void delay(uint32_t ms) {
+    if (SimClock::isVirtual()) {
+        SimClock::advanceUs((int64_t)ms * 1000);
+        return;
+    }
     std::this_thread::sleep_for(std::chrono::milliseconds(ms));
 }
 
@@ -53,3 +90,18 @@ template <typename T>
 inline T min(T a, T b) {
     return (a < b) ? a : b;
 }
+
+// Serial logging goes to stdout
+struct HostSerial {
+    __attribute__((format(printf, 2, 3)))
+    void printf(const char* fmt, ...) {
+        va_list args;
+        va_start(args, fmt);
+        std::vprintf(fmt, args);
+        va_end(args);
+    }
+    void print(const char* text) { std::fputs(text, stdout); }
+    void println(const char* text = "") { std::puts(text); }
+};
+
+inline HostSerial Serial;
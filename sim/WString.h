@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <cstring>
+
+// Host stand-in for the Arduino core's String: just enough of the API for the
+// firmware code paths that are exercised natively, backed by std::string.
+class String {
+public:
+    String(const char* text = "") : _s(text ? text : "") {}
+    String(const std::string& text) : _s(text) {}
+    explicit String(char c) : _s(1, c) {}
+
+    unsigned int length() const { return (unsigned int)_s.size(); }
+    const char* c_str() const { return _s.c_str(); }
+    char operator[](unsigned int index) const { return index < _s.size() ? _s[index] : '\0'; }
+
+    String& operator+=(char c) { _s += c; return *this; }
+    String& operator+=(const char* text) { _s += text; return *this; }
+    String& operator+=(const String& other) { _s += other._s; return *this; }
+
+    bool operator==(const char* text) const { return _s == text; }
+    bool operator==(const String& other) const { return _s == other._s; }
+    bool operator!=(const char* text) const { return _s != text; }
+
+    bool startsWith(const char* prefix) const { return _s.compare(0, std::strlen(prefix), prefix) == 0; }
+    String substring(unsigned int from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from >= _s.size() || to <= from) return String();
+        return String(_s.substr(from, to - from));
+    }
+
+    void trim() {
+        size_t begin = _s.find_first_not_of(" \t\r\n");
+        if (begin == std::string::npos) { _s.clear(); return; }
+        size_t end = _s.find_last_not_of(" \t\r\n");
+        _s = _s.substr(begin, end - begin + 1);
+    }
+
+private:
+    std::string _s;
+};
@@ -2,7 +2,9 @@
 #define ANIMATION_BASE_H
 
 #include <Arduino.h>
+#include <type_traits>
 #include "IDisplay.h"
+#include "FastTrig.h"
 
 /**
  * AnimationBase.h - Shared utilities for Valentine animations
@@ -15,44 +17,58 @@
  * All animations should use these for consistent feel.
  */
 
+// Sample Easing:: curves into tables instead of evaluating them (see Easing::ease).
+// Off by default: compare both forms on the target with the 'easing' bench.
+#ifndef EASING_TABULATED
+#define EASING_TABULATED 0
+#endif
+
+#ifndef EASING_TABLE_SIZE
+#define EASING_TABLE_SIZE 64
+#endif
+
 // ============================================================================
 // Easing Functions (0.0 to 1.0 input, 0.0 to 1.0 output)
 // These create smooth, organic motion instead of robotic linear movement
 // ============================================================================
 
 namespace Easing {
+    constexpr float cube(float x) {
+        return x * x * x;
+    }
+
     // Soft start, linear end - gentle fade in
-    inline float easeInQuad(float t) {
+    constexpr float easeInQuad(float t) {
         return t * t;
     }
     
     // Linear start, soft end - gentle fade out
-    inline float easeOutQuad(float t) {
+    constexpr float easeOutQuad(float t) {
         return t * (2.0f - t);
     }
     
     // Soft start and end - most natural for position
-    inline float easeInOutQuad(float t) {
+    constexpr float easeInOutQuad(float t) {
         return t < 0.5f ? 2.0f * t * t : -1.0f + (4.0f - 2.0f * t) * t;
     }
     
     // Even softer, more "breathing" feel
-    inline float easeInOutCubic(float t) {
-        return t < 0.5f ? 4.0f * t * t * t : 1.0f - powf(-2.0f * t + 2.0f, 3) / 2.0f;
+    constexpr float easeInOutCubic(float t) {
+        return t < 0.5f ? 4.0f * t * t * t : 1.0f - cube(-2.0f * t + 2.0f) / 2.0f;
     }
     
     // Cubic ease in only (slow start)
-    inline float easeInCubic(float t) {
+    constexpr float easeInCubic(float t) {
         return t * t * t;
     }
     
     // Cubic ease out only (slow end)
-    inline float easeOutCubic(float t) {
-        return 1.0f - powf(1.0f - t, 3);
+    constexpr float easeOutCubic(float t) {
+        return 1.0f - cube(1.0f - t);
     }
     
     // Heartbeat-style: quick rise, slow fall
-    inline float heartbeatPulse(float t) {
+    constexpr float heartbeatPulse(float t) {
         // Two-bump heartbeat curve
         if (t < 0.15f) {
             return easeOutQuad(t / 0.15f) * 0.7f;
@@ -70,8 +86,8 @@ namespace Easing {
         return (1.0f - cosf(t * 3.14159f)) / 2.0f;
     }
     
-    // Bouncy settle (for landing moments)
-    inline float easeOutBounce(float t) {
+    // Bouncy settle (for landing moments); jumps at t = 0.5, so keep it analytic
+    constexpr float easeOutBounce(float t) {
         if (t < 0.5f) {
             return easeOutQuad(t * 2.0f);
         } else if (t < 0.75f) {
@@ -81,6 +97,98 @@ namespace Easing {
             return 1.0f;
         }
     }
+
+    // ------------------------------------------------------------------------
+    // Tabulated curves: each curve is sampled at compile time into TABLE_SIZE
+    // segments and read back with linear interpolation. ease<Curve>() picks
+    // the table or the analytic function at compile time (EASING_TABULATED);
+    // curves with a discontinuity always stay analytic.
+    // ------------------------------------------------------------------------
+
+    constexpr uint16_t TABLE_SIZE = EASING_TABLE_SIZE;
+
+    template <uint16_t N>
+    struct CurveTable {
+        float value[N + 1];
+
+        constexpr float sample(float t) const {
+            if (t <= 0.0f) return value[0];
+            if (t >= 1.0f) return value[N];
+            float pos = t * N;
+            uint16_t i = (uint16_t)pos;
+            float frac = pos - i;
+            return value[i] + (value[i + 1] - value[i]) * frac;
+        }
+    };
+
+    template <typename Curve, uint16_t N>
+    constexpr CurveTable<N> sampleCurve() {
+        CurveTable<N> table{};
+        for (uint16_t i = 0; i <= N; i++) table.value[i] = Curve::exact((float)i / N);
+        return table;
+    }
+
+    template <typename Curve, uint16_t N = TABLE_SIZE>
+    inline constexpr CurveTable<N> curveTable = sampleCurve<Curve, N>();
+
+    // Curve tags: exact() must be usable at compile time, analytic() is the runtime form
+    struct InQuad {
+        static constexpr float exact(float t) { return easeInQuad(t); }
+        static float analytic(float t) { return easeInQuad(t); }
+    };
+    struct OutQuad {
+        static constexpr float exact(float t) { return easeOutQuad(t); }
+        static float analytic(float t) { return easeOutQuad(t); }
+    };
+    struct InOutQuad {
+        static constexpr float exact(float t) { return easeInOutQuad(t); }
+        static float analytic(float t) { return easeInOutQuad(t); }
+    };
+    struct InCubic {
+        static constexpr float exact(float t) { return easeInCubic(t); }
+        static float analytic(float t) { return easeInCubic(t); }
+    };
+    struct OutCubic {
+        static constexpr float exact(float t) { return easeOutCubic(t); }
+        static float analytic(float t) { return easeOutCubic(t); }
+    };
+    struct InOutCubic {
+        static constexpr float exact(float t) { return easeInOutCubic(t); }
+        static float analytic(float t) { return easeInOutCubic(t); }
+    };
+    struct HeartbeatPulse {
+        static constexpr float exact(float t) { return heartbeatPulse(t); }
+        static float analytic(float t) { return heartbeatPulse(t); }
+    };
+    struct OutBounce {
+        // The jump at t = 0.5 would be smeared across a table segment
+        static constexpr bool tabulate = false;
+        static constexpr float exact(float t) { return easeOutBounce(t); }
+        static float analytic(float t) { return easeOutBounce(t); }
+    };
+    struct Breathe {
+        // sin^2(pi t / 2) == (1 - cos(pi t)) / 2, via a constexpr series
+        static constexpr float exact(float t) {
+            double s = FastTrig::taylorSin(1.5707963267948966 * t);
+            return (float)(s * s);
+        }
+        static float analytic(float t) { return breathe(t); }
+    };
+
+    // A tag opts out of tabulation with `static constexpr bool tabulate = false`
+    template <typename Curve, typename = void>
+    inline constexpr bool tabulates = true;
+    template <typename Curve>
+    inline constexpr bool tabulates<Curve, std::void_t<decltype(Curve::tabulate)>> = Curve::tabulate;
+
+    template <typename Curve, bool TABULATED = (EASING_TABULATED != 0)>
+    inline float ease(float t) {
+        if constexpr (TABULATED && tabulates<Curve>) {
+            return curveTable<Curve>.sample(t);
+        } else {
+            return Curve::analytic(t);
+        }
+    }
 }
 
 // ============================================================================
@@ -89,7 +197,7 @@ namespace Easing {
 
 namespace ColorUtil {
     // Create RGB565 from 8-bit components
-    inline uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+    constexpr uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
         return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
     }
     
@@ -129,6 +237,55 @@ namespace ColorUtil {
         return (r << 11) | (g << 5) | b;
     }
     
+    // ------------------------------------------------------------------------
+    // Q8 fixed-point variants: factor q is 0..256 (256 = 1.0). For q/256 they
+    // return exactly what the float versions return, without float math.
+    // ------------------------------------------------------------------------
+
+    constexpr uint16_t Q8_ONE = 256;
+
+    // Float factor to Q8, clamped to 0..256
+    constexpr uint16_t toQ8(float factor) {
+        if (factor <= 0.0f) return 0;
+        if (factor >= 1.0f) return Q8_ONE;
+        return (uint16_t)(factor * 256.0f + 0.5f);
+    }
+
+    constexpr uint16_t dimColorQ8(uint16_t color, uint16_t q) {
+        if (q >= Q8_ONE) return color;
+
+        uint16_t r = (((color >> 11) & 0x1F) * q) >> 8;
+        uint16_t g = (((color >> 5) & 0x3F) * q) >> 8;
+        uint16_t b = ((color & 0x1F) * q) >> 8;
+
+        return (r << 11) | (g << 5) | b;
+    }
+
+    // blendColorQ8 without the endpoint shortcuts (the math is exact there
+    // too) for q in 0..256; branch-free, so batch loops vectorize
+    constexpr uint16_t blendChannelsQ8(uint16_t color1, uint16_t color2, uint16_t q) {
+        int16_t r1 = (color1 >> 11) & 0x1F;
+        int16_t g1 = (color1 >> 5) & 0x3F;
+        int16_t b1 = color1 & 0x1F;
+
+        // Division (not >> 8) truncates toward zero like the float cast does
+        int16_t r = r1 + (((color2 >> 11) & 0x1F) - r1) * q / 256;
+        int16_t g = g1 + (((color2 >> 5) & 0x3F) - g1) * q / 256;
+        int16_t b = b1 + ((color2 & 0x1F) - b1) * q / 256;
+
+        return (r << 11) | (g << 5) | b;
+    }
+
+    constexpr uint16_t blendColorQ8(uint16_t color1, uint16_t color2, uint16_t q) {
+        if (q == 0) return color1;
+        if (q >= Q8_ONE) return color2;
+        return blendChannelsQ8(color1, color2, q);
+    }
+
+    // Batch versions over a span of pixels (dst must not overlap a source), see ColorBatch.h
+    void dimSpanQ8(uint16_t* dst, const uint16_t* src, int16_t count, uint16_t q);
+    void blendSpanQ8(uint16_t* dst, const uint16_t* a, const uint16_t* b, int16_t count, uint16_t q);
+
     // Valentine color palette
     constexpr uint16_t DEEP_RED     = 0xC000;  // Rich romantic red
     constexpr uint16_t HEART_RED    = 0xF800;  // Classic heart red
@@ -143,6 +300,65 @@ namespace ColorUtil {
     constexpr uint16_t SEAL_RED     = 0xB000;  // Wax seal
 }
 
+// ============================================================================
+// Brightness Ramps (compile-time dimmed copies of the palette)
+// Level 0 is black, MAX_LEVEL is the full color; levels are evenly spaced Q8
+// factors, so a lookup replaces a dimColor() call at render time.
+// ============================================================================
+
+namespace ColorUtil {
+    template <uint8_t STEPS>
+    struct BrightnessRamp {
+        static_assert(STEPS >= 2, "a ramp needs at least black and full");
+        static constexpr uint8_t MAX_LEVEL = STEPS - 1;
+
+        uint16_t level[STEPS];
+
+        constexpr uint16_t operator[](uint8_t i) const {
+            return level[i < STEPS ? i : MAX_LEVEL];
+        }
+
+        // Nearest level for a 0.0-1.0 brightness, clamped
+        static constexpr uint8_t levelFor(float brightness) {
+            if (brightness <= 0.0f) return 0;
+            if (brightness >= 1.0f) return MAX_LEVEL;
+            return (uint8_t)(brightness * MAX_LEVEL + 0.5f);
+        }
+
+        constexpr uint16_t at(float brightness) const {
+            return level[levelFor(brightness)];
+        }
+    };
+
+    template <uint8_t STEPS>
+    constexpr BrightnessRamp<STEPS> makeRamp(uint16_t color) {
+        BrightnessRamp<STEPS> ramp{};
+        for (uint8_t i = 0; i < STEPS; i++) {
+            uint16_t q = (uint16_t)((i * Q8_ONE + (STEPS - 1) / 2) / (STEPS - 1));
+            ramp.level[i] = dimColorQ8(color, q);
+        }
+        return ramp;
+    }
+}
+
+namespace Ramps {
+    constexpr uint8_t STEPS = 64;   // matches the 6-bit green channel
+    using Ramp = ColorUtil::BrightnessRamp<STEPS>;
+
+    inline constexpr Ramp DEEP_RED     = ColorUtil::makeRamp<STEPS>(ColorUtil::DEEP_RED);
+    inline constexpr Ramp HEART_RED    = ColorUtil::makeRamp<STEPS>(ColorUtil::HEART_RED);
+    inline constexpr Ramp SOFT_PINK    = ColorUtil::makeRamp<STEPS>(ColorUtil::SOFT_PINK);
+    inline constexpr Ramp BLUSH_PINK   = ColorUtil::makeRamp<STEPS>(ColorUtil::BLUSH_PINK);
+    inline constexpr Ramp WARM_WHITE   = ColorUtil::makeRamp<STEPS>(ColorUtil::WARM_WHITE);
+    inline constexpr Ramp SPARKLE      = ColorUtil::makeRamp<STEPS>(ColorUtil::SPARKLE);
+    inline constexpr Ramp CORAL        = ColorUtil::makeRamp<STEPS>(ColorUtil::CORAL);
+    inline constexpr Ramp ENVELOPE_TAN = ColorUtil::makeRamp<STEPS>(ColorUtil::ENVELOPE_TAN);
+    inline constexpr Ramp SEAL_RED     = ColorUtil::makeRamp<STEPS>(ColorUtil::SEAL_RED);
+
+    static_assert(SPARKLE[Ramp::MAX_LEVEL] == ColorUtil::SPARKLE, "top level is the full color");
+    static_assert(HEART_RED[0] == 0x0000, "level 0 is black");
+}
+
 // ============================================================================
 // Common Animation Interface
 // ============================================================================
@@ -157,6 +373,9 @@ public:
     virtual void update() = 0;
     virtual void render() = 0;
     virtual bool isRunning() const = 0;
+
+    // Frame rate the main loop schedules this animation at
+    virtual uint16_t targetFps() const { return 30; }
 };
 
 #endif // ANIMATION_BASE_H
@@ -0,0 +1,153 @@
+#include "AnimationRegistry.h"
+#include "EggChickAnimation.h"
+#include "ValentineHeartbeat.h"
+#include "ValentineTwoHearts.h"
+#include "ValentineLoveLetter.h"
+#include "ValentineTextOnly.h"
+#include "ValentineTextChick.h"
+#include "Chick1Animation.h"
+#include "Mosq1Animation.h"
+#include "BakedAnimation.h"
+#include "StreamedAnimation.h"
+#include "core/CommandTable.h"
+#include "core/WordIndex.h"
+#include <string.h>
+
+// Baked clips replace their procedural animation when enabled; generate the
+// header first with the bake tool (env:native_bake).
+#if BAKED_VAL4
+#if !__has_include("baked/val4.h")
+#error "BAKED_VAL4 needs src/animations/baked/val4.h: run the bake tool for val4"
+#endif
+#include "baked/val4.h"
+#endif
+
+#if BAKED_MOSQ1
+#if !__has_include("baked/mosq1.h")
+#error "BAKED_MOSQ1 needs src/animations/baked/mosq1.h: run the bake tool for mosq1"
+#endif
+#include "baked/mosq1.h"
+#endif
+
+AnimationRegistry animationRegistry;
+
+namespace {
+IAnimation& textOnly() {
+#if BAKED_VAL4
+    static BakedAnimation baked(BakedClips::VAL4);
+    return baked;
+#else
+    return valentineTextOnly;
+#endif
+}
+
+IAnimation& mosq1() {
+#if BAKED_MOSQ1
+    static BakedAnimation baked(BakedClips::MOSQ1);
+    return baked;
+#else
+    return mosq1Animation;
+#endif
+}
+
+constexpr AnimationRegistry::Entry ENTRIES[] = {
+    {"val1", {"ANIM:VAL1", "heartbeat", "pulse"}, "Valentine Heartbeat", 0,
+     []() -> IAnimation& { return valentineHeartbeat; }},
+    {"val2", {"ANIM:VAL2", "twohearts", "love"}, "Valentine Two Hearts", 0,
+     []() -> IAnimation& { return valentineTwoHearts; }},
+    {"val3", {"ANIM:VAL3", "letter", "envelope"}, "Valentine Love Letter", 0,
+     []() -> IAnimation& { return valentineLoveLetter; }},
+    {"val4", {"ANIM:VAL4", "textlove", "ily"}, "Valentine Text-Only", 5600, textOnly},
+    {"val5", {"ANIM:VAL5", "chicklove", "ilychick"}, "Valentine Text + Chick", 0,
+     []() -> IAnimation& { return valentineTextChick; }},
+    {"chick1", {"ANIM:CHICK1", "cutechick"}, "CHICK1", 0,
+     []() -> IAnimation& { return chick1Animation; }},
+    {"mosq1", {"ANIM:MOSQ1", "mosque"}, "MOSQ1", 3600, mosq1},
+    {"egg", {"hatch", "animation/egg_chick", "chick"}, "egg hatching", 0,
+     []() -> IAnimation& { return eggChickAnimation; }},
+    // Reached through "FILE:<name>" only, so a message reading "file" stays text
+    {"file", {}, "streamed file", 0,
+     []() -> IAnimation& { return streamedAnimation; }, false},
+};
+
+constexpr uint8_t ENTRY_COUNT = sizeof(ENTRIES) / sizeof(ENTRIES[0]);
+
+constexpr size_t countWords() {
+    size_t n = 0;
+    for (const AnimationRegistry::Entry& e : ENTRIES) {
+        if (!e.commandWords) continue;
+        n++;
+        for (const char* alias : e.aliases) {
+            if (alias != nullptr) n++;
+        }
+    }
+    return n;
+}
+
+// Every name and alias, sorted by (length, bytes) for binary search
+constexpr WordIndex::Table<countWords()> collectWords() {
+    WordIndex::Table<countWords()> table{};
+    size_t n = 0;
+    for (uint8_t e = 0; e < ENTRY_COUNT; e++) {
+        if (!ENTRIES[e].commandWords) continue;
+        table.words[n++] = WordIndex::word(ENTRIES[e].name, e);
+        for (const char* alias : ENTRIES[e].aliases) {
+            if (alias != nullptr) table.words[n++] = WordIndex::word(alias, e);
+        }
+    }
+    return WordIndex::sorted(table);
+}
+
+constexpr auto WORDS = collectWords();
+static_assert(WordIndex::strictlyIncreasing(WORDS), "animation names and aliases must be unique");
+static_assert(WordIndex::strictlyIncreasing(WordIndex::merged(WORDS, WordIndex::sorted(CommandTable::CONTROL_WORDS))),
+              "an animation name or alias shadows a CommandTable control word");
+}
+
+uint8_t AnimationRegistry::count() {
+    return ENTRY_COUNT;
+}
+
+const AnimationRegistry::Entry& AnimationRegistry::entry(uint8_t index) {
+    return ENTRIES[index < ENTRY_COUNT ? index : 0];
+}
+
+int AnimationRegistry::find(const char* text, size_t len) {
+    const WordIndex::Word* word = WordIndex::find(WORDS, text, len);
+    return word != nullptr ? word->value : NOT_FOUND;
+}
+
+int AnimationRegistry::named(const char* name) {
+    for (uint8_t i = 0; i < ENTRY_COUNT; i++) {
+        if (strcmp(ENTRIES[i].name, name) == 0) return i;
+    }
+    return NOT_FOUND;
+}
+
+void AnimationRegistry::initAll(IDisplay* display) {
+    for (const Entry& e : ENTRIES) {
+        e.instance().init(display);
+    }
+}
+
+IAnimation* AnimationRegistry::start(uint8_t index) {
+    if (index >= ENTRY_COUNT) return nullptr;
+    stop();
+    IAnimation& animation = ENTRIES[index].instance();
+    animation.start();
+    _active = index;
+    return &animation;
+}
+
+void AnimationRegistry::stop() {
+    if (_active != NOT_FOUND) {
+        ENTRIES[_active].instance().stop();
+        _active = NOT_FOUND;
+    }
+}
+
+IAnimation* AnimationRegistry::running() const {
+    if (_active == NOT_FOUND) return nullptr;
+    IAnimation& animation = ENTRIES[_active].instance();
+    return animation.isRunning() ? &animation : nullptr;
+}
@@ -0,0 +1,67 @@
+#ifndef ANIMATION_REGISTRY_H
+#define ANIMATION_REGISTRY_H
+
+#include <Arduino.h>
+#include "AnimationBase.h"
+
+// Play these animations from baked clips (see BakedAnimation.h)
+#ifndef BAKED_VAL4
+#define BAKED_VAL4 0
+#endif
+
+#ifndef BAKED_MOSQ1
+#define BAKED_MOSQ1 0
+#endif
+
+/**
+ * AnimationRegistry.h - The one list of animations both entry points use
+ *
+ * Each entry names an animation (short name, command aliases, log label) and
+ * returns its instance. Adding an animation means adding one entry in
+ * AnimationRegistry.cpp; main.cpp and sim_main.cpp pick it up from here.
+ *
+ * Only the animation started through the registry can be running, so the
+ * frame loop asks running() - one isRunning() call - instead of polling all
+ * of them.
+ */
+
+class AnimationRegistry {
+public:
+    static constexpr uint8_t MAX_ALIASES = 4;
+    static constexpr int NOT_FOUND = -1;
+
+    struct Entry {
+        const char* name;                     // short name: sim argument, frame file prefix
+        const char* aliases[MAX_ALIASES];     // further command words; unused slots nullptr
+        const char* label;                    // "Starting <label> animation!"
+        uint32_t loopMs;                      // period of a fixed loop (bakeable), 0 if not periodic
+        IAnimation& (*instance)();
+        bool commandWords = true;             // false: name and aliases are not command words
+    };
+
+    static uint8_t count();
+    static const Entry& entry(uint8_t index);
+
+    // Index of the entry whose name or alias matches text exactly, or NOT_FOUND.
+    // Only entries with commandWords are matched.
+    static int find(const char* text, size_t len);
+    // Index of the entry called `name`, command word or not, or NOT_FOUND
+    static int named(const char* name);
+
+    void initAll(IDisplay* display);
+
+    // Stops the current animation and starts entry `index`
+    IAnimation* start(uint8_t index);
+    void stop();
+
+    // The started animation while it is still running, else nullptr
+    IAnimation* running() const;
+    int activeIndex() const { return _active; }
+
+private:
+    int _active = NOT_FOUND;
+};
+
+extern AnimationRegistry animationRegistry;
+
+#endif // ANIMATION_REGISTRY_H
@@ -0,0 +1,62 @@
+#include "BakedAnimation.h"
+#include "display/FrameDelta.h"
+
+void BakedAnimation::init(IDisplay* display) {
+    _display = display;
+    _running = false;
+}
+
+void BakedAnimation::start() {
+    if (_display == nullptr || _clip.frameCount == 0) return;
+    _running = true;
+    _needKeyframe = true;
+    _updated = false;
+    _shown = 0;
+    _target = 0;
+}
+
+void BakedAnimation::stop() {
+    _running = false;
+    if (_display) {
+        _display->fillScreen(0x0000);
+    }
+}
+
+bool BakedAnimation::isRunning() const {
+    return _running;
+}
+
+void BakedAnimation::update() {
+    if (!_running) return;
+    if (!_updated) {
+        _updated = true;
+        return;
+    }
+    _target = (_target + 1) % _clip.frameCount;
+}
+
+void BakedAnimation::render() {
+    if (!_running || _display == nullptr) return;
+
+    // Chunk 0 is the keyframe (frame 0); chunk i + 1 is delta i
+    if (_needKeyframe) {
+        if (!apply(0)) return;
+        _needKeyframe = false;
+        _shown = 0;
+    }
+    while (_shown != _target) {
+        _shown = (_shown + 1) % _clip.frameCount;
+        if (!apply(_shown + 1)) return;
+    }
+}
+
+bool BakedAnimation::apply(uint16_t chunk) {
+    uint32_t begin = _clip.offsets[chunk];
+    uint32_t end = _clip.offsets[chunk + 1];
+    if (FrameDelta::decode(_clip.data + begin, end - begin, _display, _clip.width, _clip.height)) {
+        return true;
+    }
+    // A corrupt clip would only smear the panel: stop and let the text come back
+    _running = false;
+    return false;
+}
@@ -0,0 +1,62 @@
+#ifndef BAKED_ANIMATION_H
+#define BAKED_ANIMATION_H
+
+#include <Arduino.h>
+#include "AnimationBase.h"
+
+/**
+ * BakedAnimation.h - Plays a pre-rendered loop instead of drawing it
+ *
+ * A BakedClip is an animation's loop rendered ahead of time by the bake tool
+ * (env:native_bake) and stored as one FrameDelta keyframe plus one delta per
+ * frame. Delta i turns frame i-1 into frame i, and delta 0 wraps the last
+ * frame back to the first, so the loop plays forever without another
+ * keyframe.
+ *
+ * The player decodes straight into the display: no frame buffer of its own,
+ * just the decoder's 64-pixel scratch row. The first update() holds frame
+ * 0, as the procedural animation would show it; each later one advances one
+ * frame at the clip's rate, and render() applies the deltas that are due.
+ * The target must keep its pixels between frames (Canvas565 or a
+ * single-buffered panel).
+ *
+ * Baked clips are opt-in per animation (BAKED_MOSQ1, BAKED_VAL4); see
+ * AnimationRegistry.cpp.
+ */
+
+struct BakedClip {
+    int16_t width;
+    int16_t height;
+    uint16_t fps;
+    uint16_t frameCount;
+    const uint8_t* data;        // keyframe, then deltas 0..frameCount-1
+    const uint32_t* offsets;    // frameCount + 2 entries into data; the last one is the end
+};
+
+class BakedAnimation : public IAnimation {
+public:
+    explicit BakedAnimation(const BakedClip& clip) : _clip(clip) {}
+
+    void init(IDisplay* display) override;
+    void start() override;
+    void stop() override;
+    void update() override;
+    void render() override;
+    bool isRunning() const override;
+    uint16_t targetFps() const override { return _clip.fps; }
+
+    uint16_t frame() const { return _target; }
+
+private:
+    const BakedClip& _clip;
+    IDisplay* _display = nullptr;
+    bool _running = false;
+    bool _needKeyframe = true;
+    bool _updated = false;      // the first update() holds frame 0
+    uint16_t _shown = 0;        // frame the display currently holds
+    uint16_t _target = 0;       // frame due on the next render()
+
+    bool apply(uint16_t chunk);
+};
+
+#endif // BAKED_ANIMATION_H
@@ -1,4 +1,5 @@
 #include "Chick1Animation.h"
+#include "Raster.h"
 #include <math.h>
 
 using namespace ColorUtil;
@@ -62,32 +63,20 @@ void Chick1Animation::render() {
     drawChickFront(cx, cy);
 }
 
-void Chick1Animation::fillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color) {
-    if (rx <= 0 || ry <= 0) return;
-    for (int16_t y = -ry; y <= ry; y++) {
-        float fy = (float)y / (float)ry;
-        float fx = sqrtf(fmaxf(0.0f, 1.0f - fy * fy));
-        int16_t halfW = (int16_t)floorf((float)rx * fx);
-        for (int16_t x = -halfW; x <= halfW; x++) {
-            drawPixelSafe(cx + x, cy + y, color);
-        }
-    }
-}
-
 void Chick1Animation::drawChickFront(int16_t cx, int16_t cy) {
     // Simple cute front-facing chick body
-    fillEllipse(cx, cy + 4, 12, 10, CHICK_MAIN);
-    fillEllipse(cx, cy - 5, 10, 8, CHICK_MAIN);
-    fillEllipse(cx, cy -10, 4, 2, CHICK_LIGHT);
-    fillEllipse(cx - 5, cy - 3, 2, 1, CHICK_LIGHT);
-    fillEllipse(cx + 5, cy - 3, 2, 1, CHICK_LIGHT);
-    fillEllipse(cx, cy + 10, 7, 2, CHICK_SHADE);
+    Raster::fillEllipse(_display, cx, cy + 4, 12, 10, CHICK_MAIN);
+    Raster::fillEllipse(_display, cx, cy - 5, 10, 8, CHICK_MAIN);
+    Raster::fillEllipse(_display, cx, cy -10, 4, 2, CHICK_LIGHT);
+    Raster::fillEllipse(_display, cx - 5, cy - 3, 2, 1, CHICK_LIGHT);
+    Raster::fillEllipse(_display, cx + 5, cy - 3, 2, 1, CHICK_LIGHT);
+    Raster::fillEllipse(_display, cx, cy + 10, 7, 2, CHICK_SHADE);
 
     // Side wings
-    fillEllipse(cx - 13, cy + 2, 5, 4, CHICK_MAIN);
-    fillEllipse(cx + 13, cy + 2, 5, 4, CHICK_MAIN);
-    fillEllipse(cx - 14, cy + 2, 3, 2, CHICK_LIGHT);
-    fillEllipse(cx + 14, cy + 2, 3, 2, CHICK_LIGHT);
+    Raster::fillEllipse(_display, cx - 13, cy + 2, 5, 4, CHICK_MAIN);
+    Raster::fillEllipse(_display, cx + 13, cy + 2, 5, 4, CHICK_MAIN);
+    Raster::fillEllipse(_display, cx - 14, cy + 2, 3, 2, CHICK_LIGHT);
+    Raster::fillEllipse(_display, cx + 14, cy + 2, 3, 2, CHICK_LIGHT);
 
     // Strong eye isolation mask: wider black band to block neighboring yellow bleed
     _display->fillRect(cx - 11, cy - 8, 22, 7, BG_BLACK);
@@ -97,14 +86,14 @@ void Chick1Animation::drawChickFront(int16_t cx, int16_t cy) {
         _display->drawFastHLine(cx + 2, cy - 5, 5, OUTLINE);
     } else {
         // Open eyes: black eyes with tiny white highlight dot
-        fillEllipse(cx - 4, cy - 5, 3, 2, BLACK);
-        fillEllipse(cx + 4, cy - 5, 3, 2, BLACK);
+        Raster::fillEllipse(_display, cx - 4, cy - 5, 3, 2, BLACK);
+        Raster::fillEllipse(_display, cx + 4, cy - 5, 3, 2, BLACK);
         drawPixelSafe(cx - 6, cy - 6, WHITE);
         drawPixelSafe(cx + 2, cy - 6, WHITE);
     }
 
     // Clear beak (top + bottom)
-    fillEllipse(cx, cy - 1, 4, 2, BEAK_MAIN);
+    Raster::fillEllipse(_display, cx, cy - 1, 4, 2, BEAK_MAIN);
     _display->drawFastHLine(cx - 3, cy - 1, 7, BEAK_DARK);
     _display->drawFastHLine(cx - 2, cy, 5, BEAK_DARK);
 
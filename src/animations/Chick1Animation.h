@@ -12,6 +12,7 @@ public:
     void update() override;
     void render() override;
     bool isRunning() const override;
+    uint16_t targetFps() const override { return 15; }   // only the 90 ms blink changes
 
 private:
     IDisplay* _display = nullptr;
@@ -20,7 +21,6 @@ private:
     float _bob = 0.0f;
 
     void drawPixelSafe(int16_t x, int16_t y, uint16_t color);
-    void fillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color);
     void drawChickFront(int16_t cx, int16_t cy);
 };
 
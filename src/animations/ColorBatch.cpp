@@ -0,0 +1,201 @@
+#include "ColorBatch.h"
+
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COLOR_BATCH_X86 1
+#include <immintrin.h>
+#else
+#define COLOR_BATCH_X86 0
+#endif
+
+namespace {
+
+// Spans never overlap (see ColorBatch.h), and the dispatchers have already
+// handled q >= Q8_ONE, so q fits 8 bits, dimColorQ8's clamp drops out and
+// channel products fit 16-bit lanes. Blocks of a fixed length give the
+// compiler a trip count it will vectorize at -O2; the tail goes per pixel.
+constexpr int SCALAR_BLOCK = 16;
+
+void dimScalar(uint16_t* __restrict dst, const uint16_t* __restrict src, int16_t count, uint8_t q) {
+    int i = 0;
+    for (; i + SCALAR_BLOCK <= count; i += SCALAR_BLOCK) {
+        uint16_t* d = dst + i;
+        const uint16_t* s = src + i;
+        for (int j = 0; j < SCALAR_BLOCK; j++) d[j] = ColorUtil::dimColorQ8(s[j], q);
+    }
+    for (; i < count; i++) dst[i] = ColorUtil::dimColorQ8(src[i], q);
+}
+
+void blendScalar(uint16_t* __restrict dst, const uint16_t* __restrict a, const uint16_t* __restrict b, int16_t count,
+                 uint8_t q) {
+    int i = 0;
+    for (; i + SCALAR_BLOCK <= count; i += SCALAR_BLOCK) {
+        uint16_t* d = dst + i;
+        const uint16_t* pa = a + i;
+        const uint16_t* pb = b + i;
+        for (int j = 0; j < SCALAR_BLOCK; j++) d[j] = ColorUtil::blendChannelsQ8(pa[j], pb[j], q);
+    }
+    for (; i < count; i++) dst[i] = ColorUtil::blendChannelsQ8(a[i], b[i], q);
+}
+
+#if COLOR_BATCH_X86
+
+// Channels fit 16-bit lanes: 63 * 256 is the largest product. Signed products
+// are shifted with a +255 bias on negatives to truncate toward zero.
+
+__attribute__((target("sse2")))
+inline __m128i truncShift8Sse2(__m128i x) {
+    __m128i bias = _mm_and_si128(_mm_srai_epi16(x, 15), _mm_set1_epi16(255));
+    return _mm_srai_epi16(_mm_add_epi16(x, bias), 8);
+}
+
+__attribute__((target("sse2")))
+void dimSse2(uint16_t* dst, const uint16_t* src, int16_t count, uint16_t q) {
+    const __m128i vq = _mm_set1_epi16((int16_t)q);
+    const __m128i m5 = _mm_set1_epi16(0x1F);
+    const __m128i m6 = _mm_set1_epi16(0x3F);
+    int16_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i p = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i r = _mm_srli_epi16(_mm_mullo_epi16(_mm_srli_epi16(p, 11), vq), 8);
+        __m128i g = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(p, 5), m6), vq), 8);
+        __m128i b = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(p, m5), vq), 8);
+        __m128i out = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+        _mm_storeu_si128((__m128i*)(dst + i), out);
+    }
+    dimScalar(dst + i, src + i, count - i, (uint8_t)q);
+}
+
+__attribute__((target("sse2")))
+void blendSse2(uint16_t* dst, const uint16_t* a, const uint16_t* b, int16_t count, uint16_t q) {
+    const __m128i vq = _mm_set1_epi16((int16_t)q);
+    const __m128i m5 = _mm_set1_epi16(0x1F);
+    const __m128i m6 = _mm_set1_epi16(0x3F);
+    int16_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i pa = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i pb = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i ra = _mm_srli_epi16(pa, 11);
+        __m128i ga = _mm_and_si128(_mm_srli_epi16(pa, 5), m6);
+        __m128i ba = _mm_and_si128(pa, m5);
+        __m128i r = _mm_add_epi16(ra, truncShift8Sse2(_mm_mullo_epi16(_mm_sub_epi16(_mm_srli_epi16(pb, 11), ra), vq)));
+        __m128i g = _mm_add_epi16(ga, truncShift8Sse2(_mm_mullo_epi16(_mm_sub_epi16(_mm_and_si128(_mm_srli_epi16(pb, 5), m6), ga), vq)));
+        __m128i bl = _mm_add_epi16(ba, truncShift8Sse2(_mm_mullo_epi16(_mm_sub_epi16(_mm_and_si128(pb, m5), ba), vq)));
+        __m128i out = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), bl);
+        _mm_storeu_si128((__m128i*)(dst + i), out);
+    }
+    blendScalar(dst + i, a + i, b + i, count - i, (uint8_t)q);
+}
+
+__attribute__((target("avx2")))
+inline __m256i truncShift8Avx2(__m256i x) {
+    __m256i bias = _mm256_and_si256(_mm256_srai_epi16(x, 15), _mm256_set1_epi16(255));
+    return _mm256_srai_epi16(_mm256_add_epi16(x, bias), 8);
+}
+
+__attribute__((target("avx2")))
+void dimAvx2(uint16_t* dst, const uint16_t* src, int16_t count, uint16_t q) {
+    const __m256i vq = _mm256_set1_epi16((int16_t)q);
+    const __m256i m5 = _mm256_set1_epi16(0x1F);
+    const __m256i m6 = _mm256_set1_epi16(0x3F);
+    int16_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i p = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i r = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_srli_epi16(p, 11), vq), 8);
+        __m256i g = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi16(p, 5), m6), vq), 8);
+        __m256i b = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_and_si256(p, m5), vq), 8);
+        __m256i out = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(r, 11), _mm256_slli_epi16(g, 5)), b);
+        _mm256_storeu_si256((__m256i*)(dst + i), out);
+    }
+    dimSse2(dst + i, src + i, count - i, q);
+}
+
+__attribute__((target("avx2")))
+void blendAvx2(uint16_t* dst, const uint16_t* a, const uint16_t* b, int16_t count, uint16_t q) {
+    const __m256i vq = _mm256_set1_epi16((int16_t)q);
+    const __m256i m5 = _mm256_set1_epi16(0x1F);
+    const __m256i m6 = _mm256_set1_epi16(0x3F);
+    int16_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i pa = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i pb = _mm256_loadu_si256((const __m256i*)(b + i));
+        __m256i ra = _mm256_srli_epi16(pa, 11);
+        __m256i ga = _mm256_and_si256(_mm256_srli_epi16(pa, 5), m6);
+        __m256i ba = _mm256_and_si256(pa, m5);
+        __m256i r = _mm256_add_epi16(ra, truncShift8Avx2(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_srli_epi16(pb, 11), ra), vq)));
+        __m256i g = _mm256_add_epi16(ga, truncShift8Avx2(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_and_si256(_mm256_srli_epi16(pb, 5), m6), ga), vq)));
+        __m256i bl = _mm256_add_epi16(ba, truncShift8Avx2(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_and_si256(pb, m5), ba), vq)));
+        __m256i out = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(r, 11), _mm256_slli_epi16(g, 5)), bl);
+        _mm256_storeu_si256((__m256i*)(dst + i), out);
+    }
+    blendSse2(dst + i, a + i, b + i, count - i, q);
+}
+
+#endif // COLOR_BATCH_X86
+
+}
+
+namespace ColorBatch {
+
+const char* isaName(Isa isa) {
+    switch (isa) {
+        case Isa::SSE2: return "sse2";
+        case Isa::AVX2: return "avx2";
+        default:        return "scalar";
+    }
+}
+
+bool isSupported(Isa isa) {
+#if COLOR_BATCH_X86
+    if (isa == Isa::AVX2) return __builtin_cpu_supports("avx2");
+    if (isa == Isa::SSE2) return __builtin_cpu_supports("sse2");
+#endif
+    return isa == Isa::SCALAR;
+}
+
+Isa activeIsa() {
+    static const Isa active = isSupported(Isa::AVX2) ? Isa::AVX2
+                            : isSupported(Isa::SSE2) ? Isa::SSE2
+                            : Isa::SCALAR;
+    return active;
+}
+
+void dimSpanQ8(Isa isa, uint16_t* dst, const uint16_t* src, int16_t count, uint16_t q) {
+    if (q >= ColorUtil::Q8_ONE) {
+        memcpy(dst, src, sizeof(uint16_t) * (count > 0 ? count : 0));
+        return;
+    }
+#if COLOR_BATCH_X86
+    if (isa == Isa::AVX2) { dimAvx2(dst, src, count, q); return; }
+    if (isa == Isa::SSE2) { dimSse2(dst, src, count, q); return; }
+#endif
+    dimScalar(dst, src, count, (uint8_t)q);
+}
+
+void blendSpanQ8(Isa isa, uint16_t* dst, const uint16_t* a, const uint16_t* b, int16_t count, uint16_t q) {
+    // Endpoints short-circuit exactly like blendColorQ8
+    if (q == 0 || q >= ColorUtil::Q8_ONE) {
+        memcpy(dst, q == 0 ? a : b, sizeof(uint16_t) * (count > 0 ? count : 0));
+        return;
+    }
+#if COLOR_BATCH_X86
+    if (isa == Isa::AVX2) { blendAvx2(dst, a, b, count, q); return; }
+    if (isa == Isa::SSE2) { blendSse2(dst, a, b, count, q); return; }
+#endif
+    blendScalar(dst, a, b, count, (uint8_t)q);
+}
+
+}
+
+namespace ColorUtil {
+
+void dimSpanQ8(uint16_t* dst, const uint16_t* src, int16_t count, uint16_t q) {
+    ColorBatch::dimSpanQ8(ColorBatch::activeIsa(), dst, src, count, q);
+}
+
+void blendSpanQ8(uint16_t* dst, const uint16_t* a, const uint16_t* b, int16_t count, uint16_t q) {
+    ColorBatch::blendSpanQ8(ColorBatch::activeIsa(), dst, a, b, count, q);
+}
+
+}
@@ -0,0 +1,29 @@
+#ifndef COLOR_BATCH_H
+#define COLOR_BATCH_H
+
+#include "AnimationBase.h"
+
+/**
+ * ColorBatch.h - Per-instruction-set variants behind ColorUtil::dimSpanQ8 /
+ * blendSpanQ8.
+ *
+ * The dispatching functions pick the widest variant the CPU supports at first
+ * use. On the ESP32 only the scalar loop exists; the SSE2/AVX2 variants are
+ * compiled on x86 hosts (native env) so the benchmark can compare them.
+ *
+ * dst must not overlap a source span; dim or blend in place through a
+ * scratch span, or per pixel with dimColorQ8 / blendColorQ8.
+ */
+
+namespace ColorBatch {
+    enum class Isa : uint8_t { SCALAR, SSE2, AVX2 };
+
+    const char* isaName(Isa isa);
+    bool isSupported(Isa isa);
+    Isa activeIsa();
+
+    void dimSpanQ8(Isa isa, uint16_t* dst, const uint16_t* src, int16_t count, uint16_t q);
+    void blendSpanQ8(Isa isa, uint16_t* dst, const uint16_t* a, const uint16_t* b, int16_t count, uint16_t q);
+}
+
+#endif // COLOR_BATCH_H
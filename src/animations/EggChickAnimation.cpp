@@ -524,14 +524,7 @@ void EggChickAnimation::render() {
         int16_t shellX = EggChickConfig::EGG_X;
         
         // Simple broken shell - just bottom portion of egg
-        for (int y = 26; y < 48; y++) {
-            for (int x = 0; x < 40; x++) {
-                uint16_t color = pgm_read_word(&eggSprite[y * 40 + x]);
-                if (color != TRANS) {
-                    _display->drawPixel(shellX + x, EggChickConfig::EGG_Y + y, color);
-                }
-            }
-        }
+        drawSprite(&eggSprite[26 * 40], shellX, shellY, 40, 48 - 26);
         
         // Draw jagged top edge of broken shell
         int16_t jaggedY = EggChickConfig::EGG_Y + 26;
@@ -593,19 +586,13 @@ void EggChickAnimation::clearScreen() {
 
 void EggChickAnimation::drawSprite(const uint16_t* sprite, int16_t x, int16_t y,
                                     uint8_t width, uint8_t height) {
+    // PROGMEM is memory-mapped on ESP32, so sprite rows can be handed to the
+    // display directly; each opaque run becomes one clipped span.
     for (uint8_t py = 0; py < height; py++) {
         int16_t screenY = y + py;
         if (screenY < 0 || screenY >= 64) continue;
-        
-        for (uint8_t px = 0; px < width; px++) {
-            int16_t screenX = x + px;
-            if (screenX < 0 || screenX >= 64) continue;
-            
-            uint16_t color = pgm_read_word(&sprite[py * width + px]);
-            if (color != TRANS) {
-                _display->drawPixel(screenX, screenY, color);
-            }
-        }
+
+        _display->drawSpanKeyed(x, screenY, &sprite[py * width], width, TRANS);
     }
 }
 
@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include "IDisplay.h"
+#include "AnimationBase.h"
 
 /**
  * Egg Chick Hatching Animation
@@ -74,41 +75,41 @@ namespace EggChickConfig {
 // Animation Class
 // ============================================================================
 
-class EggChickAnimation {
+class EggChickAnimation : public IAnimation {
 public:
     /**
      * Initialize the animation system
      * @param display Pointer to the matrix display driver
      */
-    void init(IDisplay* display);
+    void init(IDisplay* display) override;
     
     /**
      * Start the animation from the beginning
      * Call this when MQTT trigger is received
      */
-    void start();
+    void start() override;
     
     /**
      * Stop the animation immediately
      */
-    void stop();
+    void stop() override;
     
     /**
      * Update animation state (call every frame in main loop)
      * Uses internal timing - safe to call at any rate
      */
-    void update();
+    void update() override;
     
     /**
      * Render current animation frame to display
      * Call after update() in render loop
      */
-    void render();
+    void render() override;
     
     /**
      * Check if animation is currently running
      */
-    bool isRunning() const;
+    bool isRunning() const override;
     
     /**
      * Check if animation has completed
@@ -0,0 +1,130 @@
+#ifndef FAST_TRIG_H
+#define FAST_TRIG_H
+
+#include <Arduino.h>
+
+/**
+ * FastTrig.h - Table-driven sine/cosine for render loops
+ *
+ * Angles are 16-bit binary units: 65536 = one full turn, so wrap-around is
+ * free and angle arithmetic stays in integers. Results are Q15 (32767 = 1.0)
+ * or float for drop-in use next to existing float math.
+ *
+ * The quarter-wave table is built at compile time. Precision is a template
+ * parameter; the defaults below (1024 steps per turn, interpolated, 514 bytes
+ * of flash) stay within about 0.0001 of sinf().
+ */
+
+#ifndef FAST_TRIG_TABLE_BITS
+#define FAST_TRIG_TABLE_BITS 10
+#endif
+
+#ifndef FAST_TRIG_INTERPOLATE
+#define FAST_TRIG_INTERPOLATE 1
+#endif
+
+namespace FastTrig {
+    using Angle = uint16_t;
+
+    constexpr uint32_t FULL_TURN = 65536;
+    constexpr Angle HALF_TURN = 32768;
+    constexpr Angle QUARTER_TURN = 16384;
+    constexpr float UNITS_PER_RADIAN = FULL_TURN / 6.283185307f;
+
+    // ------------------------------------------------------------------------
+    // Angle conversions
+    // ------------------------------------------------------------------------
+
+    // Fraction of a turn (1.0 = 360 degrees); wraps, negative values allowed
+    constexpr Angle fromTurns(float turns) {
+        return (Angle)(int32_t)(turns * FULL_TURN);
+    }
+
+    // Radians to angle units; accurate for |rad| up to ~30000
+    constexpr Angle fromRadians(float rad) {
+        return (Angle)(int32_t)(rad * UNITS_PER_RADIAN);
+    }
+
+    // Angular speed in Q16 angle units per millisecond, for angleAt()
+    constexpr uint32_t ratePerMs(float radPerMs) {
+        return (uint32_t)(radPerMs * UNITS_PER_RADIAN * 65536.0f + 0.5f);
+    }
+
+    // Phase of a rotation after t milliseconds; never loses precision as t grows
+    inline Angle angleAt(uint32_t t, uint32_t rate) {
+        return (Angle)(((uint64_t)t * rate) >> 16);
+    }
+
+    // ------------------------------------------------------------------------
+    // Compile-time quarter-wave table
+    // ------------------------------------------------------------------------
+
+    constexpr double taylorSin(double x) {
+        double term = x;
+        double sum = x;
+        for (int n = 1; n < 12; n++) {
+            term *= -x * x / ((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    template <uint8_t BITS>
+    struct QuarterTable {
+        static constexpr uint16_t STEPS = 1 << (BITS - 2);
+        int16_t value[STEPS + 1];
+    };
+
+    template <uint8_t BITS>
+    constexpr QuarterTable<BITS> makeQuarterTable() {
+        QuarterTable<BITS> table{};
+        for (uint16_t i = 0; i <= QuarterTable<BITS>::STEPS; i++) {
+            double s = taylorSin(1.5707963267948966 * i / QuarterTable<BITS>::STEPS);
+            table.value[i] = (int16_t)(s * 32767.0 + 0.5);
+        }
+        return table;
+    }
+
+    template <uint8_t BITS, bool INTERPOLATE>
+    struct Sine {
+        static_assert(BITS >= 4 && BITS <= 14, "table bits out of range");
+        static constexpr uint16_t STEPS = QuarterTable<BITS>::STEPS;
+        static constexpr uint8_t SHIFT = 16 - BITS;
+        static constexpr uint16_t FRAC_MASK = (1 << SHIFT) - 1;
+        static inline constexpr QuarterTable<BITS> table = makeQuarterTable<BITS>();
+
+        static int16_t q15(Angle a) {
+            // Fold onto the first quadrant: mirror odd quadrants, negate the lower half
+            uint16_t pos = a & (QUARTER_TURN - 1);
+            if (a & QUARTER_TURN) pos = QUARTER_TURN - pos;
+
+            int16_t v;
+            if (INTERPOLATE) {
+                uint16_t i = pos >> SHIFT;
+                uint16_t frac = pos & FRAC_MASK;
+                v = table.value[i];
+                if (frac) v += ((int32_t)(table.value[i + 1] - v) * frac) >> SHIFT;
+            } else {
+                v = table.value[(pos + (FRAC_MASK >> 1)) >> SHIFT];
+            }
+            return (a & HALF_TURN) ? -v : v;
+        }
+    };
+
+    using DefaultSine = Sine<FAST_TRIG_TABLE_BITS, FAST_TRIG_INTERPOLATE != 0>;
+
+    // ------------------------------------------------------------------------
+    // Lookups
+    // ------------------------------------------------------------------------
+
+    inline int16_t sinQ15(Angle a) { return DefaultSine::q15(a); }
+    inline int16_t cosQ15(Angle a) { return DefaultSine::q15(a + QUARTER_TURN); }
+
+    inline float sin(Angle a) { return sinQ15(a) * (1.0f / 32767.0f); }
+    inline float cos(Angle a) { return cosQ15(a) * (1.0f / 32767.0f); }
+
+    // Scale an integer by a Q15 factor (e.g. radius * cosQ15)
+    inline int32_t mulQ15(int32_t v, int16_t q15) { return (v * q15) >> 15; }
+}
+
+#endif // FAST_TRIG_H
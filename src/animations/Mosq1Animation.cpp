@@ -1,4 +1,6 @@
 #include "Mosq1Animation.h"
+#include "FastTrig.h"
+#include "Raster.h"
 #include <math.h>
 
 using namespace ColorUtil;
@@ -13,6 +15,20 @@ const uint16_t MOSQUE_BLUE_DARK = rgb565(18, 64, 168);
 const uint16_t STAR_WHITE = rgb565(255, 255, 255);
 const uint16_t STAR_SOFT = rgb565(170, 210, 255);
 const uint16_t MOON_WHITE = rgb565(245, 248, 255);
+
+// One shooting star per cycle: a pass of ACTIVE_MS, then a pause. Everything
+// is a function of the time within the cycle, so the animation loops exactly
+// (the registry's loopMs, and what the bake tool relies on).
+constexpr uint32_t CYCLE_MS = 3600;
+constexpr uint32_t ACTIVE_MS = 1450;
+
+// Comet head shimmer: whole turns per cycle, about 4 and 3 Hz
+constexpr uint32_t CORE_PULSE_TURNS = 14;
+constexpr uint32_t GLOW_PULSE_TURNS = 10;
+
+inline FastTrig::Angle cyclePhase(uint32_t local, uint32_t turns) {
+    return (FastTrig::Angle)((uint64_t)local * turns * FastTrig::FULL_TURN / CYCLE_MS);
+}
 }
 
 void Mosq1Animation::init(IDisplay* display) {
@@ -27,6 +43,7 @@ void Mosq1Animation::start() {
 
 void Mosq1Animation::stop() {
     _running = false;
+    _background.release();
     if (_display) {
         _display->fillScreen(SKY_BLACK);
     }
@@ -43,68 +60,71 @@ void Mosq1Animation::update() {
 void Mosq1Animation::render() {
     if (!_running || _display == nullptr) return;
 
-    _display->fillScreen(SKY_BLACK);
+    _background.restore(_display, [this](IDisplay* target) { drawBackground(target); });
 
     uint32_t t = millis();
 
-    // One sophisticated shooting star: pause + constant-speed arc sweep
-    constexpr uint32_t cycleMs = 3600;
-    constexpr uint32_t activeMs = 1450;
-    uint32_t local = t % cycleMs;
-    if (local < activeMs) {
-        float p = (float)local / (float)activeMs;
+    // One sophisticated shooting star: pause + constant-speed arc sweep.
+    // Its path stays above the minarets, so drawing it over the cached
+    // mosque matches drawing it underneath.
+    uint32_t local = t % CYCLE_MS;
+    if (local < ACTIVE_MS) {
+        float p = (float)local / (float)ACTIVE_MS;
 
         // Arc trajectory (high-left -> slight rise -> lower-right), constant speed in parameter space
         int16_t sx = (int16_t)(-10 + p * 86.0f);
-        float yArc = 6.0f + p * 11.0f - 5.0f * sinf(p * 3.14159f);
+        float yArc = 6.0f + p * 11.0f - 5.0f * FastTrig::sin(FastTrig::fromTurns(p * 0.5f));
         int16_t sy = (int16_t)yArc;
         drawShootingStar(sx, sy);
     }
+}
 
-    drawMosque();
+void Mosq1Animation::drawBackground(IDisplay* target) {
+    target->fillScreen(SKY_BLACK);
+    drawMosque(target);
 
     // Ramadan text under mosque
-    _display->setTextSize(1);
-    _display->setTextWrap(false);
-    _display->setTextColor(rgb565(220, 235, 255));
-    _display->setCursor(11, 54);
-    _display->print("RAMADAN");
+    target->setTextSize(1);
+    target->setTextWrap(false);
+    target->setTextColor(rgb565(220, 235, 255));
+    target->setCursor(11, 54);
+    target->print("RAMADAN");
 }
 
-void Mosq1Animation::drawMosque() {
+void Mosq1Animation::drawMosque(IDisplay* target) {
     // Base platform
-    _display->fillRect(8, 47, 48, 4, MOSQUE_BLUE_DARK);
+    target->fillRect(8, 47, 48, 4, MOSQUE_BLUE_DARK);
 
     // Main body
-    _display->fillRect(16, 34, 32, 13, MOSQUE_WHITE);
-    _display->drawRect(16, 34, 32, 13, MOSQUE_BLUE);
+    target->fillRect(16, 34, 32, 13, MOSQUE_WHITE);
+    target->drawRect(16, 34, 32, 13, MOSQUE_BLUE);
 
     // Central dome
-    fillCircle(32, 32, 8, MOSQUE_BLUE);
-    fillCircle(32, 32, 5, MOSQUE_WHITE);
-    drawPixelSafe(32, 23, MOSQUE_BLUE_DARK);
+    Raster::fillCircle(target, 32, 32, 8, MOSQUE_BLUE);
+    Raster::fillCircle(target, 32, 32, 5, MOSQUE_WHITE);
+    target->drawPixel(32, 23, MOSQUE_BLUE_DARK);
 
     // Side mini domes
-    fillCircle(22, 35, 3, MOSQUE_BLUE);
-    fillCircle(42, 35, 3, MOSQUE_BLUE);
+    Raster::fillCircle(target, 22, 35, 3, MOSQUE_BLUE);
+    Raster::fillCircle(target, 42, 35, 3, MOSQUE_BLUE);
 
     // Pillars / minarets
-    _display->fillRect(10, 24, 6, 23, MOSQUE_WHITE);
-    _display->drawRect(10, 24, 6, 23, MOSQUE_BLUE);
-    _display->fillRect(48, 24, 6, 23, MOSQUE_WHITE);
-    _display->drawRect(48, 24, 6, 23, MOSQUE_BLUE);
+    target->fillRect(10, 24, 6, 23, MOSQUE_WHITE);
+    target->drawRect(10, 24, 6, 23, MOSQUE_BLUE);
+    target->fillRect(48, 24, 6, 23, MOSQUE_WHITE);
+    target->drawRect(48, 24, 6, 23, MOSQUE_BLUE);
 
     // Minaret caps
-    fillCircle(13, 23, 3, MOSQUE_BLUE);
-    fillCircle(51, 23, 3, MOSQUE_BLUE);
+    Raster::fillCircle(target, 13, 23, 3, MOSQUE_BLUE);
+    Raster::fillCircle(target, 51, 23, 3, MOSQUE_BLUE);
 
     // Arched door + windows accents
-    _display->fillRect(29, 39, 6, 8, MOSQUE_BLUE_DARK);
-    _display->fillRect(20, 39, 4, 5, MOSQUE_BLUE);
-    _display->fillRect(40, 39, 4, 5, MOSQUE_BLUE);
+    target->fillRect(29, 39, 6, 8, MOSQUE_BLUE_DARK);
+    target->fillRect(20, 39, 4, 5, MOSQUE_BLUE);
+    target->fillRect(40, 39, 4, 5, MOSQUE_BLUE);
 
     // Half moon (crescent) on right pillar top
-    drawCrescent(51, 18, MOON_WHITE);
+    drawCrescent(target, 51, 18, MOON_WHITE);
 }
 
 void Mosq1Animation::drawStar(int16_t x, int16_t y, uint16_t color, bool sparkle) {
@@ -123,12 +143,12 @@ void Mosq1Animation::drawStar(int16_t x, int16_t y, uint16_t color, bool sparkle
 }
 
 void Mosq1Animation::drawShootingStar(int16_t x, int16_t y) {
-    uint32_t t = millis();
+    uint32_t local = millis() % CYCLE_MS;
 
     // Pulsing head brightness gives a sparkling comet core
-    float pulse = 0.82f + 0.18f * (0.5f + 0.5f * sinf((float)t * 0.025f));
+    float pulse = 0.82f + 0.18f * (0.5f + 0.5f * FastTrig::sin(cyclePhase(local, CORE_PULSE_TURNS)));
     uint16_t headCore = dimColor(STAR_WHITE, pulse);
-    uint16_t headGlow = dimColor(STAR_SOFT, 0.72f + 0.10f * sinf((float)t * 0.018f));
+    uint16_t headGlow = dimColor(STAR_SOFT, 0.72f + 0.10f * FastTrig::sin(cyclePhase(local, GLOW_PULSE_TURNS)));
 
     // Comet head + glow halo
     drawPixelSafe(x, y, headCore);
@@ -142,9 +162,7 @@ void Mosq1Animation::drawShootingStar(int16_t x, int16_t y) {
     drawPixelSafe(x + 1, y + 1, dimColor(headGlow, 0.45f));
 
     // Trail follows the same arc path by sampling earlier positions in time
-    constexpr uint32_t cycleMs = 3600;
-    constexpr uint32_t activeMs = 1450;
-    float pHead = (float)(millis() % cycleMs) / (float)activeMs;
+    float pHead = (float)local / (float)ACTIVE_MS;
     if (pHead > 1.0f) pHead = 1.0f;
 
     for (int16_t i = 1; i <= 14; i++) {
@@ -153,7 +171,7 @@ void Mosq1Animation::drawShootingStar(int16_t x, int16_t y) {
         if (pt < 0.0f) break;
 
         int16_t tx = (int16_t)(-10 + pt * 86.0f);
-        int16_t ty = (int16_t)(6.0f + pt * 11.0f - 5.0f * sinf(pt * 3.14159f));
+        int16_t ty = (int16_t)(6.0f + pt * 11.0f - 5.0f * FastTrig::sin(FastTrig::fromTurns(pt * 0.5f)));
 
         float f = 1.0f - ((float)i / 14.0f);
         uint16_t base = (i < 4) ? STAR_WHITE : STAR_SOFT;
@@ -171,16 +189,9 @@ void Mosq1Animation::drawShootingStar(int16_t x, int16_t y) {
     }
 }
 
-void Mosq1Animation::drawCrescent(int16_t cx, int16_t cy, uint16_t color) {
-    fillCircle(cx, cy, 3, color);
-    fillCircle(cx + 1, cy, 2, SKY_BLACK);
-}
-
-void Mosq1Animation::fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
-    for (int16_t y = -r; y <= r; y++) {
-        int16_t dx = (int16_t)sqrtf((float)(r * r - y * y));
-        _display->drawFastHLine(cx - dx, cy + y, dx * 2 + 1, color);
-    }
+void Mosq1Animation::drawCrescent(IDisplay* target, int16_t cx, int16_t cy, uint16_t color) {
+    Raster::fillCircle(target, cx, cy, 3, color);
+    Raster::fillCircle(target, cx + 1, cy, 2, SKY_BLACK);
 }
 
 void Mosq1Animation::drawPixelSafe(int16_t x, int16_t y, uint16_t color) {
@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include "AnimationBase.h"
+#include "display/StaticLayer.h"
 
 class Mosq1Animation : public IAnimation {
 public:
@@ -12,17 +13,19 @@ public:
     void update() override;
     void render() override;
     bool isRunning() const override;
+    uint16_t targetFps() const override { return 60; }   // shooting star moves ~60 px/s
 
 private:
     IDisplay* _display = nullptr;
     bool _running = false;
+    StaticLayer _background;    // sky, mosque and caption
 
     void drawPixelSafe(int16_t x, int16_t y, uint16_t color);
     void drawStar(int16_t x, int16_t y, uint16_t color, bool sparkle);
     void drawShootingStar(int16_t x, int16_t y);
-    void drawCrescent(int16_t cx, int16_t cy, uint16_t color);
-    void fillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color);
-    void drawMosque();
+    void drawCrescent(IDisplay* target, int16_t cx, int16_t cy, uint16_t color);
+    void drawBackground(IDisplay* target);
+    void drawMosque(IDisplay* target);
 };
 
 extern Mosq1Animation mosq1Animation;
@@ -0,0 +1,49 @@
+#include "Raster.h"
+#include "AnimationBase.h"
+
+namespace Raster {
+
+void fillSpan(IDisplay* display, int16_t y, int16_t x0, int16_t x1, uint16_t color) {
+    if (y < 0 || y >= display->height()) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 >= display->width()) x1 = display->width() - 1;
+    if (x1 < x0) return;
+    display->drawFastHLine(x0, y, x1 - x0 + 1, color);
+}
+
+void fillCircle(IDisplay* display, int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    forEachCircleSpan(cx, cy, r, [&](int16_t y, int16_t x0, int16_t x1) {
+        fillSpan(display, y, x0, x1, color);
+    });
+}
+
+void fillEllipse(IDisplay* display, int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color) {
+    forEachEllipseSpan(cx, cy, rx, ry, [&](int16_t y, int16_t x0, int16_t x1) {
+        fillSpan(display, y, x0, x1, color);
+    });
+}
+
+void strokeEllipse(IDisplay* display, int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color) {
+    int16_t w = display->width();
+    int16_t h = display->height();
+    forEachEllipsePoint(cx, cy, rx, ry, [&](int16_t x, int16_t y) {
+        if (x >= 0 && x < w && y >= 0 && y < h) display->drawPixel(x, y, color);
+    });
+}
+
+void glowEllipse(IDisplay* display, int16_t cx, int16_t cy, int16_t rx, int16_t ry,
+                 uint16_t color, uint8_t halo, uint16_t falloffQ8) {
+    // Outermost (dimmest) bands first so the outline lands on top
+    for (uint8_t k = halo; k >= 1; k--) {
+        uint16_t q = ColorUtil::Q8_ONE;
+        for (uint8_t i = 0; i < k; i++) q = (q * falloffQ8) >> 8;
+        uint16_t c = ColorUtil::dimColorQ8(color, q);
+        auto band = [&](int16_t y, int16_t x0, int16_t x1) { fillSpan(display, y, x0, x1, c); };
+
+        forEachEllipseRingSpan(cx, cy, rx + k, ry + k, rx + k - 1, ry + k - 1, band);
+        forEachEllipseRingSpan(cx, cy, rx - k + 1, ry - k + 1, rx - k, ry - k, band);
+    }
+    strokeEllipse(display, cx, cy, rx, ry, color);
+}
+
+}
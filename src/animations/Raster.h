@@ -0,0 +1,158 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <Arduino.h>
+#include "IDisplay.h"
+
+/**
+ * Raster.h - Integer scanline rasterizer for filled circles and ellipses
+ *
+ * Shapes are walked row by row from the center outward with the midpoint
+ * test (x^2 + y^2 <= r^2, no sqrt), producing one horizontal span per row.
+ * Spans are clipped once against the display and sent as drawFastHLine.
+ *
+ * forEachCircleSpan / forEachEllipseSpan expose the raw spans for callers
+ * that want to do something other than a solid fill.
+ *
+ * Outlines use the two-region midpoint ellipse walk, which visits each
+ * 8-connected boundary pixel exactly once. Rings (the band between two
+ * ellipses) are spans of the outer fill minus the inner fill, so stacked
+ * rings tile without gaps or overlap.
+ */
+
+namespace Raster {
+    // fn(y, x0, x1) for each row, x0..x1 inclusive, unclipped
+    template <typename SpanFn>
+    void forEachCircleSpan(int16_t cx, int16_t cy, int16_t r, SpanFn&& fn) {
+        if (r < 0) return;
+        int32_t rr = (int32_t)r * r;
+        int16_t x = r;
+        for (int16_t dy = 0; dy <= r; dy++) {
+            while ((int32_t)x * x + (int32_t)dy * dy > rr) x--;
+            fn(cy - dy, cx - x, cx + x);
+            if (dy != 0) fn(cy + dy, cx - x, cx + x);
+        }
+    }
+
+    template <typename SpanFn>
+    void forEachEllipseSpan(int16_t cx, int16_t cy, int16_t rx, int16_t ry, SpanFn&& fn) {
+        if (rx <= 0 || ry <= 0) return;
+        int32_t rx2 = (int32_t)rx * rx;
+        int32_t ry2 = (int32_t)ry * ry;
+        int32_t limit = rx2 * ry2;
+        int16_t x = rx;
+        for (int16_t dy = 0; dy <= ry; dy++) {
+            while ((int32_t)x * x * ry2 + (int32_t)dy * dy * rx2 > limit) x--;
+            fn(cy - dy, cx - x, cx + x);
+            if (dy != 0) fn(cy + dy, cx - x, cx + x);
+        }
+    }
+
+    // fn(x, y) once per outline pixel, 8-connected, unclipped
+    template <typename PointFn>
+    void forEachEllipsePoint(int16_t cx, int16_t cy, int16_t rx, int16_t ry, PointFn&& fn) {
+        if (rx < 0 || ry < 0) return;
+        if (rx == 0 || ry == 0) {
+            for (int16_t y = -ry; y <= ry; y++) {
+                for (int16_t x = -rx; x <= rx; x++) fn(cx + x, cy + y);
+            }
+            return;
+        }
+
+        auto plot4 = [&](int16_t x, int16_t y) {
+            fn(cx + x, cy + y);
+            if (x != 0) fn(cx - x, cy + y);
+            if (y != 0) {
+                fn(cx + x, cy - y);
+                if (x != 0) fn(cx - x, cy - y);
+            }
+        };
+
+        // Decision variables are scaled by 4 to stay integral
+        int32_t rx2 = (int32_t)rx * rx;
+        int32_t ry2 = (int32_t)ry * ry;
+        int16_t x = 0;
+        int16_t y = ry;
+        int32_t dx = 0;                  // 2 * ry2 * x
+        int32_t dy = 2 * rx2 * y;        // 2 * rx2 * y
+
+        // Region 1: slope shallower than -1, step x every pixel
+        int32_t d = 4 * ry2 - 4 * rx2 * ry + rx2;
+        while (dx < dy) {
+            plot4(x, y);
+            x++;
+            dx += 2 * ry2;
+            if (d < 0) {
+                d += 4 * (dx + ry2);
+            } else {
+                y--;
+                dy -= 2 * rx2;
+                d += 4 * (dx - dy + ry2);
+            }
+        }
+
+        // Region 2: slope steeper than -1, step y every pixel
+        d = ry2 * (2 * x + 1) * (2 * x + 1) + 4 * rx2 * (int32_t)(y - 1) * (y - 1) - 4 * rx2 * ry2;
+        while (y >= 0) {
+            plot4(x, y);
+            y--;
+            dy -= 2 * rx2;
+            if (d > 0) {
+                d += 4 * (rx2 - dy);
+            } else {
+                x++;
+                dx += 2 * ry2;
+                d += 4 * (dx - dy + rx2);
+            }
+        }
+    }
+
+    // fn(y, x0, x1) for the pixels inside the outer ellipse but not the inner one
+    template <typename SpanFn>
+    void forEachEllipseRingSpan(int16_t cx, int16_t cy, int16_t rxOuter, int16_t ryOuter,
+                                int16_t rxInner, int16_t ryInner, SpanFn&& fn) {
+        if (rxOuter <= 0 || ryOuter <= 0) return;
+        bool hasInner = rxInner > 0 && ryInner > 0;
+
+        int32_t ox2 = (int32_t)rxOuter * rxOuter, oy2 = (int32_t)ryOuter * ryOuter;
+        int32_t ix2 = (int32_t)rxInner * rxInner, iy2 = (int32_t)ryInner * ryInner;
+        int16_t xo = rxOuter;
+        int16_t xi = rxInner;
+
+        auto emit = [&](int16_t y, int16_t outer, int16_t inner) {
+            if (inner < 0) {
+                fn(y, cx - outer, cx + outer);
+            } else if (inner < outer) {
+                fn(y, cx - outer, cx - inner - 1);
+                fn(y, cx + inner + 1, cx + outer);
+            }
+        };
+
+        for (int16_t dy = 0; dy <= ryOuter; dy++) {
+            while ((int32_t)xo * xo * oy2 + (int32_t)dy * dy * ox2 > ox2 * oy2) xo--;
+            int16_t inner = -1;
+            if (hasInner && dy <= ryInner) {
+                while ((int32_t)xi * xi * iy2 + (int32_t)dy * dy * ix2 > ix2 * iy2) xi--;
+                inner = xi;
+            }
+            emit(cy - dy, xo, inner);
+            if (dy != 0) emit(cy + dy, xo, inner);
+        }
+    }
+
+    // Clip x0..x1 (inclusive) on row y to the display and draw it
+    void fillSpan(IDisplay* display, int16_t y, int16_t x0, int16_t x1, uint16_t color);
+
+    void fillCircle(IDisplay* display, int16_t cx, int16_t cy, int16_t r, uint16_t color);
+    void fillEllipse(IDisplay* display, int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color);
+
+    // 1-pixel outline
+    void strokeEllipse(IDisplay* display, int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color);
+
+    // Outline plus `halo` bands on each side, band k dimmed by falloffQ8^k
+    // (Q8, 256 = no falloff). halo = 0 is a plain strokeEllipse.
+    void glowEllipse(IDisplay* display, int16_t cx, int16_t cy, int16_t rx, int16_t ry,
+                     uint16_t color, uint8_t halo = 0, uint16_t falloffQ8 = 128);
+}
+
+#endif // RASTER_H
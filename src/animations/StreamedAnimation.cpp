@@ -0,0 +1,155 @@
+#include "StreamedAnimation.h"
+#include <string.h>
+
+StreamedAnimation streamedAnimation;
+
+namespace {
+#ifdef SIMULATION
+const char* ANIM_DIR = "data/anims/";
+#else
+const char* ANIM_DIR = "/anims/";
+#endif
+
+void animPath(char (&path)[64], const char* name, size_t len) {
+    snprintf(path, sizeof(path), "%s%.*s.anim", ANIM_DIR, (int)len, name);
+}
+
+bool fitsPanel(const char* path, const AnimFile::Header& header, const IDisplay* display) {
+    if (header.width == display->width() && header.height == display->height()) return true;
+    Serial.printf("%s is %ux%u, panel is %dx%d\n", path, header.width, header.height, display->width(),
+                  display->height());
+    return false;
+}
+}
+
+// ----------------------------------------------------------------------------
+// AnimFileSource
+// ----------------------------------------------------------------------------
+
+#ifdef SIMULATION
+
+bool AnimFileSource::open(const char* path) {
+    close();
+    _file = std::fopen(path, "rb");
+    return _file != nullptr;
+}
+
+void AnimFileSource::close() {
+    if (_file != nullptr) std::fclose(_file);
+    _file = nullptr;
+}
+
+bool AnimFileSource::seek(uint32_t offset) {
+    return _file != nullptr && std::fseek(_file, (long)offset, SEEK_SET) == 0;
+}
+
+size_t AnimFileSource::read(uint8_t* buf, size_t maxLen) {
+    return _file != nullptr ? std::fread(buf, 1, maxLen, _file) : 0;
+}
+
+#else
+
+bool AnimFileSource::open(const char* path) {
+    close();
+    _file = LittleFS.open(path, "r");
+    return (bool)_file;
+}
+
+void AnimFileSource::close() {
+    if (_file) _file.close();
+}
+
+bool AnimFileSource::seek(uint32_t offset) {
+    return _file && _file.seek(offset);
+}
+
+size_t AnimFileSource::read(uint8_t* buf, size_t maxLen) {
+    return _file ? _file.read(buf, maxLen) : 0;
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// StreamedAnimation
+// ----------------------------------------------------------------------------
+
+void StreamedAnimation::setFile(const char* name, size_t len) {
+    if (len > MAX_NAME) len = MAX_NAME;
+    memcpy(_name, name, len);
+    _name[len] = '\0';
+}
+
+bool StreamedAnimation::canPlay(const char* name, size_t len) const {
+    if (_display == nullptr || len == 0) return false;
+    if (len > MAX_NAME) len = MAX_NAME;
+
+    char path[64];
+    animPath(path, name, len);
+    AnimFileSource source;
+    uint8_t raw[AnimFile::HEADER_SIZE];
+    AnimFile::Header header;
+    if (!source.open(path) || source.read(raw, sizeof(raw)) != sizeof(raw) || !AnimFile::parseHeader(raw, header)) {
+        Serial.printf("Cannot play %s\n", path);
+        return false;
+    }
+    return fitsPanel(path, header, _display);
+}
+
+void StreamedAnimation::init(IDisplay* display) {
+    _display = display;
+    _running = false;
+}
+
+void StreamedAnimation::start() {
+    if (_display == nullptr || _name[0] == '\0') return;
+
+    char path[64];
+    animPath(path, _name, strlen(_name));
+    if (!_source.open(path) || !_reader.open(&_source)) {
+        Serial.printf("Cannot play %s\n", path);
+        _source.close();
+        return;
+    }
+    if (!fitsPanel(path, _reader.header(), _display)) {
+        stop();
+        return;
+    }
+    _pending = 0;
+    _running = true;
+}
+
+void StreamedAnimation::stop() {
+    _running = false;
+    _reader.close();
+    _source.close();
+    if (_display) {
+        _display->fillScreen(0x0000);
+    }
+}
+
+bool StreamedAnimation::isRunning() const {
+    return _running;
+}
+
+uint16_t StreamedAnimation::targetFps() const {
+    return _reader.isOpen() ? _reader.header().fps : 30;
+}
+
+void StreamedAnimation::update() {
+    if (!_running) return;
+    if (_pending < _reader.header().frameCount) _pending++;
+}
+
+void StreamedAnimation::render() {
+    if (!_running || _display == nullptr) return;
+
+    // Each update() makes one more frame due: the first one frame 0
+    while (_pending > 0) {
+        if (!_reader.nextFrame(_display)) {
+            Serial.printf("Corrupt animation file %s\n", _name);
+            stop();
+            return;
+        }
+        _pending--;
+    }
+}
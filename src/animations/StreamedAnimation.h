@@ -0,0 +1,73 @@
+#ifndef STREAMED_ANIMATION_H
+#define STREAMED_ANIMATION_H
+
+#include <Arduino.h>
+#include "AnimationBase.h"
+#include "display/AnimFile.h"
+
+#ifdef SIMULATION
+#include <cstdio>
+#else
+#include <LittleFS.h>
+#endif
+
+/**
+ * StreamedAnimation.h - Plays a .anim file from the flash filesystem
+ *
+ * New animations can be uploaded to LittleFS (pio run -t uploadfs, files
+ * under data/anims/) without rebuilding the firmware; "FILE:<name>" plays
+ * /anims/<name>.anim. The file is streamed frame by frame through
+ * AnimFile::Reader, never loaded whole. In the simulator the same name is
+ * read from data/anims/ on the host, so sim and device play the same files.
+ */
+
+// LittleFS file on the device, stdio file on the host
+class AnimFileSource : public AnimFile::Reader::Source {
+public:
+    ~AnimFileSource() override { close(); }
+
+    bool open(const char* path);
+    void close();
+
+    bool seek(uint32_t offset) override;
+    size_t read(uint8_t* buf, size_t maxLen) override;
+
+private:
+#ifdef SIMULATION
+    FILE* _file = nullptr;
+#else
+    fs::File _file;
+#endif
+};
+
+class StreamedAnimation : public IAnimation {
+public:
+    static constexpr size_t MAX_NAME = 31;
+
+    // Selects /anims/<name>.anim for the next start()
+    void setFile(const char* name, size_t len);
+    // Whether /anims/<name>.anim opens and fits the panel; reads only the
+    // header and leaves the file being played alone
+    bool canPlay(const char* name, size_t len) const;
+    const char* fileName() const { return _name; }
+
+    void init(IDisplay* display) override;
+    void start() override;
+    void stop() override;
+    void update() override;
+    void render() override;
+    bool isRunning() const override;
+    uint16_t targetFps() const override;
+
+private:
+    IDisplay* _display = nullptr;
+    bool _running = false;
+    char _name[MAX_NAME + 1] = {0};
+    AnimFileSource _source;
+    AnimFile::Reader _reader;
+    uint16_t _pending = 0;      // update() steps not yet rendered
+};
+
+extern StreamedAnimation streamedAnimation;
+
+#endif // STREAMED_ANIMATION_H
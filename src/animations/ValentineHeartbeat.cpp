@@ -1,4 +1,6 @@
 #include "ValentineHeartbeat.h"
+#include "FastTrig.h"
+#include "Raster.h"
 #include <math.h>
 
 using namespace ColorUtil;
@@ -13,7 +15,7 @@ constexpr uint8_t STAR_COUNT = 24;
 struct Star {
     float x;
     float y;
-    float phase;
+    FastTrig::Angle phase;
 };
 
 Star stars[STAR_COUNT];
@@ -40,7 +42,7 @@ void initStars() {
     for (uint8_t i = 0; i < STAR_COUNT; i++) {
         stars[i].x = random(64);
         stars[i].y = random(64);
-        stars[i].phase = random(628) / 100.0f;
+        stars[i].phase = FastTrig::fromRadians(random(628) / 100.0f + i);
     }
 }
 }
@@ -91,13 +93,13 @@ void ValentineHeartbeat::update() {
             _brightness = 1.0f;
             transitionTo(HeartbeatState::BREATHE);
         } else {
-            _brightness = easeInOutCubic(constrain(p, 0.0f, 1.0f));
+            _brightness = ease<InOutCubic>(constrain(p, 0.0f, 1.0f));
         }
         return;
     }
 
     float beatT = ((now - _animStartTime) % 1600UL) / 1600.0f;
-    float pulse = heartbeatPulse(beatT);
+    float pulse = ease<HeartbeatPulse>(beatT);
     _currentScale = 0.95f + pulse * 0.42f;
     _glowRadius = 2.0f + 24.0f * beatT;
     _glowAlpha = 0.15f + 0.85f * pulse;
@@ -118,9 +120,10 @@ void ValentineHeartbeat::render() {
 
     // Starfield twinkle
     uint32_t t = millis();
+    FastTrig::Angle twinkle = FastTrig::angleAt(t, FastTrig::ratePerMs(0.0035f));
     for (uint8_t i = 0; i < STAR_COUNT; i++) {
-        float tw = 0.35f + 0.65f * (0.5f + 0.5f * sinf(stars[i].phase + t * 0.0035f + i));
-        drawPixelSafe((int16_t)stars[i].x, (int16_t)stars[i].y, dimColor(SPARKLE, tw * 0.55f));
+        float tw = 0.35f + 0.65f * (0.5f + 0.5f * FastTrig::sin(stars[i].phase + twinkle));
+        drawPixelSafe((int16_t)stars[i].x, (int16_t)stars[i].y, Ramps::SPARKLE.at(tw * 0.55f));
     }
 
     // ECG line baseline + pulse
@@ -151,29 +154,36 @@ void ValentineHeartbeat::drawHeart(float scale, float brightness) {
     int16_t cy = HEART_CENTER_Y - 4;
     int16_t pixelSize = (scale > 1.15f) ? 3 : 2;
 
-    uint16_t edge = dimColor(SPARKLE, 0.9f * brightness);
-    uint16_t fillA = dimColor(HEART_RED, brightness);
-    uint16_t fillB = dimColor(CORAL, brightness);
+    uint16_t edge = Ramps::SPARKLE.at(0.9f * brightness);
+    uint16_t fillA = Ramps::HEART_RED.at(brightness);
+    uint16_t fillB = Ramps::CORAL.at(brightness);
+
+    // Compose each scanline of the heart, then push its opaque runs as spans
+    const int16_t x0 = cx - 7 * pixelSize;
+    const int16_t spanW = 15 * pixelSize;
+    uint16_t line[15 * 3];
 
     for (int row = 0; row < 15; row++) {
         uint16_t bits = HEART_ROWS[row];
-        for (int col = 0; col < 15; col++) {
-            if (!(bits & (1 << (14 - col)))) continue;
+        if (bits == 0) continue;
+
+        for (int py = 0; py < pixelSize; py++) {
+            for (int col = 0; col < 15; col++) {
+                uint16_t* cell = &line[col * pixelSize];
+                if (!(bits & (1 << (14 - col)))) {
+                    for (int px = 0; px < pixelSize; px++) cell[px] = MAGENTA;
+                    continue;
+                }
 
-            int16_t x = cx + (col - 7) * pixelSize;
-            int16_t y = cy + (row - 7) * pixelSize;
-            uint16_t body = (row < 5 || col < 5) ? fillB : fillA;
+                uint16_t body = (row < 5 || col < 5) ? fillB : fillA;
+                for (int px = 0; px < pixelSize; px++) cell[px] = body;
 
-            for (int py = 0; py < pixelSize; py++) {
-                for (int px = 0; px < pixelSize; px++) {
-                    drawPixelSafe(x + px, y + py, body);
+                // Crisp edge highlights
+                if (py == 0 && (row == 0 || row == 14 || col == 0 || col == 14 || !(bits & (1 << (14 - max(0, col - 1)))))) {
+                    cell[0] = edge;
                 }
             }
-
-            // Crisp edge highlights
-            if (row == 0 || row == 14 || col == 0 || col == 14 || !(bits & (1 << (14 - max(0, col - 1))))) {
-                drawPixelSafe(x, y, edge);
-            }
+            _display->drawSpanKeyed(x0, cy + (row - 7) * pixelSize + py, line, spanW, MAGENTA);
         }
     }
 }
@@ -187,12 +197,11 @@ void ValentineHeartbeat::drawGlowRings() {
         float alpha = _glowAlpha * (1.0f - ring * 0.22f);
         if (alpha < 0.05f) continue;
 
-        uint16_t c = dimColor(SOFT_PINK, alpha * 0.4f);
-        for (float a = 0; a < 6.28318f; a += 0.09f) {
-            int16_t x = cx + (int16_t)(cosf(a) * rad);
-            int16_t y = cy + (int16_t)(sinf(a) * rad * 0.8f);
-            drawPixelSafe(x, y, c);
-        }
+        uint16_t c = Ramps::SOFT_PINK.at(alpha * 0.4f);
+        int16_t rx = (int16_t)(rad + 0.5f);
+        int16_t ry = (int16_t)(rad * 0.8f + 0.5f);
+        // Rings are 3 px apart: a one-band halo each side fills the gap between them
+        Raster::glowEllipse(_display, cx, cy, rx, ry, c, 1, GLOW_FALLOFF_Q8);
     }
 }
 
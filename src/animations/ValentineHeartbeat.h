@@ -97,6 +97,7 @@ namespace HeartbeatConfig {
     // Glow properties
     constexpr uint8_t  GLOW_RINGS         = 4;
     constexpr float    GLOW_RING_SPACING  = 3.0f;
+    constexpr uint16_t GLOW_FALLOFF_Q8    = 96;    // halo band brightness vs. its ring
 }
 
 // ============================================================================
@@ -111,6 +112,7 @@ public:
     void update() override;
     void render() override;
     bool isRunning() const override;
+    uint16_t targetFps() const override { return 60; }   // smooth glow ring pulse
     
 private:
     IDisplay* _display = nullptr;
@@ -1,4 +1,5 @@
 #include "ValentineLoveLetter.h"
+#include "Raster.h"
 #include <math.h>
 
 using namespace ColorUtil;
@@ -70,13 +71,6 @@ inline uint16_t hsvTo565(uint8_t h, uint8_t s, uint8_t v) {
 
     return rgb565(r, g, b);
 }
-
-void drawDisc(IDisplay* display, int16_t cx, int16_t cy, int16_t r, uint16_t color) {
-    for (int16_t y = -r; y <= r; y++) {
-        int16_t dx = (int16_t)sqrtf((float)(r * r - y * y));
-        display->drawFastHLine(cx - dx, cy + y, dx * 2 + 1, color);
-    }
-}
 }
 
 void ValentineLoveLetter::init(IDisplay* display) {
@@ -109,6 +103,7 @@ void ValentineLoveLetter::start() {
 
 void ValentineLoveLetter::stop() {
     _state = LoveLetterState::INACTIVE;
+    _card.release();
     if (_display) {
         _display->fillScreen(BG_BLACK);
     }
@@ -128,7 +123,7 @@ void ValentineLoveLetter::update() {
 
     uint32_t now = millis();
     float beatT = (now % 1700UL) / 1700.0f;
-    float beat = heartbeatPulse(beatT);
+    float beat = ease<HeartbeatPulse>(beatT);
 
     _heartScale = 0.95f + 0.45f * beat;
     _heartBrightness = 0.9f + 0.1f * beat;
@@ -150,23 +145,14 @@ void ValentineLoveLetter::render() {
 
     uint32_t now = millis();
 
-    const int16_t cardX = 1;
-    const int16_t cardY = 17;
-    const int16_t cardW = 62;
-    const int16_t cardH = 30;
-
-    const int16_t guardX0 = cardX - 2;
-    const int16_t guardY0 = cardY - 2;
-    const int16_t guardX1 = cardX + cardW + 1;
-    const int16_t guardY1 = cardY + cardH + 1;
+    // Rows under the card are copied from the cached layer instead
+    const int16_t cardTop = LoveLetterConfig::CARD_Y - LoveLetterConfig::CARD_GUARD;
+    const int16_t cardBottom = LoveLetterConfig::CARD_Y + LoveLetterConfig::CARD_HEIGHT + LoveLetterConfig::CARD_GUARD - 1;
 
     // Dim diagonal rainbow background
     for (int16_t y = 0; y < 64; y++) {
+        if (y >= cardTop && y <= cardBottom) continue;
         for (int16_t x = 0; x < 64; x++) {
-            if (x >= guardX0 && x <= guardX1 && y >= guardY0 && y <= guardY1) {
-                drawPixelSafe(x, y, BG_BLACK);
-                continue;
-            }
             uint8_t hue = (uint8_t)((x * 2 + y * 2 + (now / 32)) & 0xFF);
             uint16_t c = hsvTo565(hue, 160, 34);
             drawPixelSafe(x, y, c);
@@ -175,22 +161,16 @@ void ValentineLoveLetter::render() {
 
     // Slight dark overlay bands so text/heart stand out more
     for (int16_t y = 0; y < 64; y += 2) {
+        if (y >= cardTop && y <= cardBottom) continue;
         _display->drawFastHLine(0, y, 64, dimColor(BG_BLACK, 0.18f));
     }
 
+    _card.restore(_display, [this](IDisplay* target) { drawCard(target); });
+
     // Text and heart layout: I ❤ YOU
     int16_t baseY = 22;
     int16_t xHeart = 21;
 
-    // Solid black card behind text/heart for contrast
-    _display->fillRect(cardX, cardY, cardW, cardH, BG_BLACK);
-    _display->drawRect(cardX, cardY, cardW, cardH, BG_BLACK);
-    _display->drawRect(cardX + 1, cardY + 1, cardW - 2, cardH - 2, BG_BLACK);
-
-    drawEnvelope(true);
-    drawEnvelopeFlap(0.0f);
-    drawSeal(0.0f);
-
     // Heart in center (beats)
     drawHeart(xHeart + 6, baseY + 6, _heartScale, _heartBrightness);
 
@@ -201,7 +181,18 @@ void ValentineLoveLetter::render() {
     }
 }
 
-void ValentineLoveLetter::drawEnvelope(bool drawSeal) {
+void ValentineLoveLetter::drawCard(IDisplay* target) {
+    using namespace LoveLetterConfig;
+
+    // Solid black card behind text/heart for contrast
+    target->fillRect(0, CARD_Y - CARD_GUARD, 64, CARD_HEIGHT + 2 * CARD_GUARD, BG_BLACK);
+
+    drawEnvelope(target, true);
+    drawEnvelopeFlap(target, 0.0f);
+    drawSeal(0.0f);
+}
+
+void ValentineLoveLetter::drawEnvelope(IDisplay* target, bool drawSeal) {
     (void)drawSeal;
 
     // Draw thick "I"
@@ -228,7 +219,7 @@ void ValentineLoveLetter::drawEnvelope(bool drawSeal) {
     for (int16_t py = 0; py < glyphH; py++) {
         for (int16_t px = 0; px < glyphW; px++) {
             if (mask[py][px]) {
-                drawPixelSafe(x + px, y + py, mainColor);
+                drawPixelSafe(target, x + px, y + py, mainColor);
             }
         }
     }
@@ -250,13 +241,13 @@ void ValentineLoveLetter::drawEnvelope(bool drawSeal) {
                 }
             }
             if (edge) {
-                drawPixelSafe(x + px, y + py, outlineColor);
+                drawPixelSafe(target, x + px, y + py, outlineColor);
             }
         }
     }
 }
 
-void ValentineLoveLetter::drawEnvelopeFlap(float openProgress) {
+void ValentineLoveLetter::drawEnvelopeFlap(IDisplay* target, float openProgress) {
     (void)openProgress;
 
     // Draw thick "YOU"
@@ -288,7 +279,7 @@ void ValentineLoveLetter::drawEnvelopeFlap(float openProgress) {
         for (int16_t py = 0; py < glyphH; py++) {
             for (int16_t px = 0; px < glyphW; px++) {
                 if (mask[py][px]) {
-                    drawPixelSafe(gx + px, y + py, mainColor);
+                    drawPixelSafe(target, gx + px, y + py, mainColor);
                 }
             }
         }
@@ -310,7 +301,7 @@ void ValentineLoveLetter::drawEnvelopeFlap(float openProgress) {
                     }
                 }
                 if (edge) {
-                    drawPixelSafe(gx + px, y + py, outlineColor);
+                    drawPixelSafe(target, gx + px, y + py, outlineColor);
                 }
             }
         }
@@ -328,8 +319,8 @@ void ValentineLoveLetter::drawHeart(int16_t x, int16_t y, float scale, float bri
     uint16_t cHi = dimColor(rgb565(255, 96, 96), min(1.0f, brightness * 1.05f));
 
     // Heart body (two circles + triangle)
-    drawDisc(_display, x - r / 2, y - r / 3, r, cMain);
-    drawDisc(_display, x + r / 2, y - r / 3, r, cMain);
+    Raster::fillCircle(_display, x - r / 2, y - r / 3, r, cMain);
+    Raster::fillCircle(_display, x + r / 2, y - r / 3, r, cMain);
 
     int16_t topY = y;
     int16_t bottomY = y + (int16_t)(r * 1.7f);
@@ -340,7 +331,7 @@ void ValentineLoveLetter::drawHeart(int16_t x, int16_t y, float scale, float bri
     }
 
     // Highlight
-    drawDisc(_display, x - r / 2, y - r / 3, max(1, r / 3), cHi);
+    Raster::fillCircle(_display, x - r / 2, y - r / 3, max(1, r / 3), cHi);
 }
 
 void ValentineLoveLetter::drawConfetti() {}
@@ -348,7 +339,11 @@ void ValentineLoveLetter::initConfetti() {}
 void ValentineLoveLetter::updateConfettiPhysics() {}
 
 void ValentineLoveLetter::drawPixelSafe(int16_t x, int16_t y, uint16_t color) {
+    drawPixelSafe(_display, x, y, color);
+}
+
+void ValentineLoveLetter::drawPixelSafe(IDisplay* target, int16_t x, int16_t y, uint16_t color) {
     if (x >= 0 && x < 64 && y >= 0 && y < 64) {
-        _display->drawPixel(x, y, color);
+        target->drawPixel(x, y, color);
     }
 }
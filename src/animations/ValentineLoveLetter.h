@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include "AnimationBase.h"
+#include "display/StaticLayer.h"
 
 /**
  * ═══════════════════════════════════════════════════════════════════════════
@@ -115,6 +116,11 @@ namespace LoveLetterConfig {
     constexpr int16_t ENV_WIDTH = 40;
     constexpr int16_t ENV_HEIGHT = 28;
     
+    // Full-width black card behind the lettering, plus a black guard band kept clear of the rainbow
+    constexpr int16_t CARD_Y = 17;
+    constexpr int16_t CARD_HEIGHT = 30;
+    constexpr int16_t CARD_GUARD = 2;
+    
     // Heart position
     constexpr int16_t HEART_START_Y = 35;
     constexpr int16_t HEART_END_Y = 8;
@@ -163,6 +169,10 @@ private:
     float _heartY;
     float _heartScale;
     float _heartBrightness;
+
+    // Black card with the "I  YOU" lettering; the rainbow around it moves
+    StaticLayer _card{0, LoveLetterConfig::CARD_Y - LoveLetterConfig::CARD_GUARD, 64,
+                      LoveLetterConfig::CARD_HEIGHT + 2 * LoveLetterConfig::CARD_GUARD};
     
     // Confetti particles
     struct Confetti {
@@ -189,14 +199,16 @@ private:
     void updateRest();
     
     // Rendering
-    void drawEnvelope(bool drawSeal);
-    void drawEnvelopeFlap(float openProgress);
+    void drawCard(IDisplay* target);
+    void drawEnvelope(IDisplay* target, bool drawSeal);
+    void drawEnvelopeFlap(IDisplay* target, float openProgress);
     void drawSeal(float glow);
     void drawHeart(int16_t x, int16_t y, float scale, float brightness);
     void drawConfetti();
     void initConfetti();
     void updateConfettiPhysics();
     void drawPixelSafe(int16_t x, int16_t y, uint16_t color);
+    static void drawPixelSafe(IDisplay* target, int16_t x, int16_t y, uint16_t color);
 };
 
 // Global instance
@@ -1,4 +1,5 @@
 #include "ValentineTextChick.h"
+#include "FastTrig.h"
 #include <math.h>
 
 using namespace ColorUtil;
@@ -128,7 +129,7 @@ void ValentineTextChick::update() {
 
     float walkT = fmodf((float)millis(), 360.0f) / 360.0f;
     _stepA = walkT < 0.5f;
-    _chickBob = sinf(walkT * 6.2831853f) * 0.35f;
+    _chickBob = FastTrig::sin(FastTrig::fromTurns(walkT)) * 0.35f;
 }
 
 void ValentineTextChick::render() {
@@ -182,17 +183,14 @@ void ValentineTextChick::drawGlyph4x6(const uint8_t glyph[6], int16_t x, int16_t
         }
     }
 
+    // Fill and outline never overlap, so each glyph row goes out as one keyed span
+    uint16_t line[MAX_W];
     for (int16_t py = 0; py < glyphH; py++) {
         for (int16_t px = 0; px < glyphW; px++) {
             if (mask[py][px]) {
-                drawPixelSafe(x + px, y + py, mainColor);
+                line[px] = mainColor;
+                continue;
             }
-        }
-    }
-
-    for (int16_t py = 0; py < glyphH; py++) {
-        for (int16_t px = 0; px < glyphW; px++) {
-            if (mask[py][px]) continue;
 
             bool isEdge = false;
             for (int8_t oy = -1; oy <= 1 && !isEdge; oy++) {
@@ -208,10 +206,9 @@ void ValentineTextChick::drawGlyph4x6(const uint8_t glyph[6], int16_t x, int16_t
                 }
             }
 
-            if (isEdge) {
-                drawPixelSafe(x + px, y + py, outlineColor);
-            }
+            line[px] = isEdge ? outlineColor : MAGENTA;
         }
+        _display->drawSpanKeyed(x, y + py, line, glyphW, MAGENTA);
     }
 }
 
@@ -239,8 +236,12 @@ void ValentineTextChick::drawHeart(int16_t cx, int16_t cy, float scale, float br
     int16_t x0 = cx - outW / 2;
     int16_t y0 = cy - outH / 2;
 
-    uint16_t cMain = dimColor(HEART_RED, brightness);
-    uint16_t cWhite = dimColor(SPARKLE, brightness * 0.95f);
+    uint16_t cMain = Ramps::HEART_RED.at(brightness);
+    uint16_t cWhite = Ramps::SPARKLE.at(brightness * 0.95f);
+
+    constexpr int16_t MAX_W = 32;
+    if (outW > MAX_W) return;
+    uint16_t line[MAX_W];
 
     for (int16_t oy = 0; oy < outH; oy++) {
         int16_t srcY = min<int16_t>(baseH - 1, (int16_t)floorf(((oy + 0.5f) / outH) * baseH));
@@ -248,9 +249,9 @@ void ValentineTextChick::drawHeart(int16_t cx, int16_t cy, float scale, float br
 
         for (int16_t ox = 0; ox < outW; ox++) {
             int16_t srcX = min<int16_t>(baseW - 1, (int16_t)floorf(((ox + 0.5f) / outW) * baseW));
-            if (!(bits & (1 << (12 - srcX)))) continue;
-            drawPixelSafe(x0 + ox, y0 + oy, cMain);
+            line[ox] = (bits & (1 << (12 - srcX))) ? cMain : MAGENTA;
         }
+        _display->drawSpanKeyed(x0, y0 + oy, line, outW, MAGENTA);
     }
 
     int16_t hx = x0 + max<int16_t>(1, (int16_t)(outW * 0.30f));
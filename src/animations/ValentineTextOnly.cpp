@@ -58,6 +58,7 @@ void ValentineTextOnly::start() {
 
 void ValentineTextOnly::stop() {
     _running = false;
+    _background.release();
     if (_display) {
         _display->fillScreen(BG_BLACK);
     }
@@ -103,7 +104,17 @@ void ValentineTextOnly::update() {
 void ValentineTextOnly::render() {
     if (!_running || _display == nullptr) return;
 
-    _display->fillScreen(BG_BLACK);
+    _background.restore(_display, [this](IDisplay* target) { drawBackground(target); });
+
+    const int16_t y = 22;
+    drawHeart(24, y + 8, _heartScale, _heartBrightness);
+
+    // At full pulse the heart reaches the Y's first column; the Y stays in front
+    drawGlyph4x6(_display, GLYPH_Y, 31, y, SPARKLE, dimColor(SOFT_PINK, 0.95f), 2);
+}
+
+void ValentineTextOnly::drawBackground(IDisplay* target) {
+    target->fillScreen(BG_BLACK);
 
     // 2px red border around the full text/heart composition
     const int16_t boxX = 2;
@@ -111,8 +122,8 @@ void ValentineTextOnly::render() {
     const int16_t boxW = 60;
     const int16_t boxH = 29;
     uint16_t borderColor = HEART_RED;
-    _display->drawRect(boxX, boxY, boxW, boxH, borderColor);
-    _display->drawRect(boxX + 1, boxY + 1, boxW - 2, boxH - 2, borderColor);
+    target->drawRect(boxX, boxY, boxW, boxH, borderColor);
+    target->drawRect(boxX + 1, boxY + 1, boxW - 2, boxH - 2, borderColor);
 
     const uint8_t cell = 2;
     const int16_t y = 22;
@@ -120,15 +131,13 @@ void ValentineTextOnly::render() {
     uint16_t textMain = SPARKLE;
     uint16_t textOutline = dimColor(SOFT_PINK, 0.95f);
 
-    drawGlyph4x6(GLYPH_I, 6, y, textMain, textOutline, cell);
-    drawHeart(24, y + 8, _heartScale, _heartBrightness);
-
-    drawGlyph4x6(GLYPH_Y, 31, y, textMain, textOutline, cell);
-    drawGlyph4x6(GLYPH_O, 41, y, textMain, textOutline, cell);
-    drawGlyph4x6(GLYPH_U, 51, y, textMain, textOutline, cell);
+    drawGlyph4x6(target, GLYPH_I, 6, y, textMain, textOutline, cell);
+    drawGlyph4x6(target, GLYPH_Y, 31, y, textMain, textOutline, cell);
+    drawGlyph4x6(target, GLYPH_O, 41, y, textMain, textOutline, cell);
+    drawGlyph4x6(target, GLYPH_U, 51, y, textMain, textOutline, cell);
 }
 
-void ValentineTextOnly::drawGlyph4x6(const uint8_t glyph[6], int16_t x, int16_t y, uint16_t mainColor, uint16_t outlineColor, uint8_t cell) {
+void ValentineTextOnly::drawGlyph4x6(IDisplay* target, const uint8_t glyph[6], int16_t x, int16_t y, uint16_t mainColor, uint16_t outlineColor, uint8_t cell) {
     const int16_t glyphW = 4 * cell;
     const int16_t glyphH = 6 * cell;
 
@@ -151,17 +160,14 @@ void ValentineTextOnly::drawGlyph4x6(const uint8_t glyph[6], int16_t x, int16_t
         }
     }
 
+    // Fill and outline never overlap, so each glyph row goes out as one keyed span
+    uint16_t line[MAX_W];
     for (int16_t py = 0; py < glyphH; py++) {
         for (int16_t px = 0; px < glyphW; px++) {
             if (mask[py][px]) {
-                drawPixelSafe(x + px, y + py, mainColor);
+                line[px] = mainColor;
+                continue;
             }
-        }
-    }
-
-    for (int16_t py = 0; py < glyphH; py++) {
-        for (int16_t px = 0; px < glyphW; px++) {
-            if (mask[py][px]) continue;
 
             bool isEdge = false;
             for (int8_t oy = -1; oy <= 1 && !isEdge; oy++) {
@@ -177,10 +183,9 @@ void ValentineTextOnly::drawGlyph4x6(const uint8_t glyph[6], int16_t x, int16_t
                 }
             }
 
-            if (isEdge) {
-                drawPixelSafe(x + px, y + py, outlineColor);
-            }
+            line[px] = isEdge ? outlineColor : MAGENTA;
         }
+        target->drawSpanKeyed(x, y + py, line, glyphW, MAGENTA);
     }
 }
 
@@ -209,8 +214,12 @@ void ValentineTextOnly::drawHeart(int16_t cx, int16_t cy, float scale, float bri
     int16_t x0 = cx - outW / 2;
     int16_t y0 = cy - outH / 2;
 
-    uint16_t cMain = dimColor(HEART_RED, brightness);
-    uint16_t cWhite = dimColor(SPARKLE, brightness * 0.95f);
+    uint16_t cMain = Ramps::HEART_RED.at(brightness);
+    uint16_t cWhite = Ramps::SPARKLE.at(brightness * 0.95f);
+
+    constexpr int16_t MAX_W = 32;
+    if (outW > MAX_W) return;
+    uint16_t line[MAX_W];
 
     // Scale by mapping output pixel back into base heart mask
     for (int16_t oy = 0; oy < outH; oy++) {
@@ -219,9 +228,9 @@ void ValentineTextOnly::drawHeart(int16_t cx, int16_t cy, float scale, float bri
 
         for (int16_t ox = 0; ox < outW; ox++) {
             int16_t srcX = min<int16_t>(baseW - 1, (int16_t)floorf(((ox + 0.5f) / outW) * baseW));
-            if (!(bits & (1 << (12 - srcX)))) continue;
-            drawPixelSafe(x0 + ox, y0 + oy, cMain);
+            line[ox] = (bits & (1 << (12 - srcX))) ? cMain : MAGENTA;
         }
+        _display->drawSpanKeyed(x0, y0 + oy, line, outW, MAGENTA);
     }
 
     // Small white light inside the heart
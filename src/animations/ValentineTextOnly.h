@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include "AnimationBase.h"
+#include "display/StaticLayer.h"
 
 class ValentineTextOnly : public IAnimation {
 public:
@@ -18,10 +19,12 @@ private:
     bool _running = false;
     float _heartScale = 1.0f;
     float _heartBrightness = 1.0f;
+    StaticLayer _background;    // border and "I  YOU" lettering
 
     void drawPixelSafe(int16_t x, int16_t y, uint16_t color);
     void drawHeart(int16_t cx, int16_t cy, float scale, float brightness);
-    void drawGlyph4x6(const uint8_t glyph[6], int16_t x, int16_t y, uint16_t mainColor, uint16_t outlineColor, uint8_t cell);
+    void drawBackground(IDisplay* target);
+    void drawGlyph4x6(IDisplay* target, const uint8_t glyph[6], int16_t x, int16_t y, uint16_t mainColor, uint16_t outlineColor, uint8_t cell);
 };
 
 extern ValentineTextOnly valentineTextOnly;
@@ -1,4 +1,6 @@
 #include "ValentineTwoHearts.h"
+#include "FastTrig.h"
+#include "Raster.h"
 #include <math.h>
 
 using namespace ColorUtil;
@@ -10,13 +12,6 @@ namespace {
 constexpr int16_t ROSE_CX = 32;
 constexpr int16_t ROSE_CY = 34;
 constexpr int16_t STEM_BOTTOM_Y = 63;
-
-void drawDisc(IDisplay* display, int16_t cx, int16_t cy, int16_t r, uint16_t color) {
-    for (int16_t y = -r; y <= r; y++) {
-        int16_t xr = (int16_t)sqrtf((float)(r * r - y * y));
-        display->drawFastHLine(cx - xr, cy + y, xr * 2 + 1, color);
-    }
-}
 }
 
 void ValentineTwoHearts::init(IDisplay* display) {
@@ -82,7 +77,7 @@ void ValentineTwoHearts::updateAppear() {
         transitionTo(TwoHeartsState::NOTICE);
         return;
     }
-    _leftBrightness = easeInOutCubic(constrain(p, 0.0f, 1.0f));
+    _leftBrightness = ease<InOutCubic>(constrain(p, 0.0f, 1.0f));
 }
 
 void ValentineTwoHearts::updateNotice() {
@@ -91,7 +86,7 @@ void ValentineTwoHearts::updateNotice() {
         transitionTo(TwoHeartsState::APPROACH);
         return;
     }
-    _leftScale = 0.45f + 0.05f * sinf(p * 6.28318f);
+    _leftScale = 0.45f + 0.05f * FastTrig::sin(FastTrig::fromTurns(p));
 }
 
 void ValentineTwoHearts::updateApproach() {
@@ -101,7 +96,7 @@ void ValentineTwoHearts::updateApproach() {
         transitionTo(TwoHeartsState::MERGE);
         return;
     }
-    _mergeProgress = easeOutCubic(constrain(p, 0.0f, 1.0f));
+    _mergeProgress = ease<OutCubic>(constrain(p, 0.0f, 1.0f));
     _leftScale = 0.45f + 0.55f * _mergeProgress;
 }
 
@@ -111,7 +106,7 @@ void ValentineTwoHearts::updateMerge() {
         transitionTo(TwoHeartsState::UNITY);
         return;
     }
-    _rightScale = 1.0f + 0.14f * sinf(p * 6.28318f);
+    _rightScale = 1.0f + 0.14f * FastTrig::sin(FastTrig::fromTurns(p));
 }
 
 void ValentineTwoHearts::updateUnity() {
@@ -120,7 +115,7 @@ void ValentineTwoHearts::updateUnity() {
         transitionTo(TwoHeartsState::SEPARATE);
         return;
     }
-    _rightBrightness = 0.8f + 0.2f * sinf(p * 8.0f * 3.14159f);
+    _rightBrightness = 0.8f + 0.2f * FastTrig::sin(FastTrig::fromTurns(p * 4.0f));
 }
 
 void ValentineTwoHearts::updateSeparate() {
@@ -129,7 +124,7 @@ void ValentineTwoHearts::updateSeparate() {
         transitionTo(TwoHeartsState::RETURN_HOME);
         return;
     }
-    _leftScale = 1.0f - 0.45f * easeInOutCubic(constrain(p, 0.0f, 1.0f));
+    _leftScale = 1.0f - 0.45f * ease<InOutCubic>(constrain(p, 0.0f, 1.0f));
 }
 
 void ValentineTwoHearts::updateReturn() {
@@ -181,38 +176,43 @@ void ValentineTwoHearts::drawSmallHeart(int16_t cx, int16_t cy, float scale, uin
 void ValentineTwoHearts::drawMergedHeart(float progress) {
     float bloom = _leftScale;
     int16_t petalBase = 3 + (int16_t)(5 * bloom);
-    uint16_t deep = dimColor(HEART_RED, _leftBrightness);
-    uint16_t light = dimColor(CORAL, _leftBrightness);
+    uint16_t deep = Ramps::HEART_RED.at(_leftBrightness);
+    uint16_t light = Ramps::CORAL.at(_leftBrightness);
 
     // Outer petals
+    uint32_t t = millis();
+    FastTrig::Angle petalSpin = FastTrig::angleAt(t, FastTrig::ratePerMs(0.0006f));
     for (int i = 0; i < 8; i++) {
-        float a = (i / 8.0f) * 6.28318f + millis() * 0.0006f;
-        int16_t px = ROSE_CX + (int16_t)(cosf(a) * (4 + petalBase));
-        int16_t py = ROSE_CY + (int16_t)(sinf(a) * (3 + petalBase * 0.8f));
-        drawDisc(_display, px, py, 2 + (int16_t)(bloom * 2), (i % 2 == 0) ? deep : light);
+        FastTrig::Angle a = i * (FastTrig::FULL_TURN / 8) + petalSpin;
+        int16_t px = ROSE_CX + (int16_t)(FastTrig::cos(a) * (4 + petalBase));
+        int16_t py = ROSE_CY + (int16_t)(FastTrig::sin(a) * (3 + petalBase * 0.8f));
+        Raster::fillCircle(_display, px, py, 2 + (int16_t)(bloom * 2), (i % 2 == 0) ? deep : light);
     }
 
     // Inner swirl
+    FastTrig::Angle swirlSpin = FastTrig::angleAt(t, FastTrig::ratePerMs(0.0013f));
     for (int i = 0; i < 12; i++) {
         float s = i / 11.0f;
-        float a = s * 7.5f + millis() * 0.0013f;
+        FastTrig::Angle a = FastTrig::fromRadians(s * 7.5f) + swirlSpin;
         float r = s * (3.0f + petalBase * 0.7f);
-        int16_t px = ROSE_CX + (int16_t)(cosf(a) * r);
-        int16_t py = ROSE_CY + (int16_t)(sinf(a) * r * 0.75f);
-        drawDisc(_display, px, py, 1 + (int16_t)(progress * 2), dimColor(blendColor(deep, light, s), 0.9f));
+        int16_t px = ROSE_CX + (int16_t)(FastTrig::cos(a) * r);
+        int16_t py = ROSE_CY + (int16_t)(FastTrig::sin(a) * r * 0.75f);
+        Raster::fillCircle(_display, px, py, 1 + (int16_t)(progress * 2), dimColor(blendColor(deep, light, s), 0.9f));
     }
 
     // Core highlight
-    drawDisc(_display, ROSE_CX, ROSE_CY, 2 + (int16_t)(_rightScale * 1.5f), dimColor(WARM_WHITE, 0.75f + 0.2f * _rightBrightness));
+    Raster::fillCircle(_display, ROSE_CX, ROSE_CY, 2 + (int16_t)(_rightScale * 1.5f), Ramps::WARM_WHITE.at(0.75f + 0.2f * _rightBrightness));
 }
 
 void ValentineTwoHearts::drawSparkles() {
     uint32_t t = millis();
+    FastTrig::Angle orbit = FastTrig::angleAt(t, FastTrig::ratePerMs(0.002f));
+    FastTrig::Angle breathe = FastTrig::angleAt(t, FastTrig::ratePerMs(0.0013f));
     for (int i = 0; i < 10; i++) {
-        float a = i * 0.62f + t * 0.002f;
-        float r = 8.0f + 7.0f * (0.5f + 0.5f * sinf(t * 0.0013f + i));
-        int16_t x = ROSE_CX + (int16_t)(cosf(a) * r);
-        int16_t y = ROSE_CY - 4 + (int16_t)(sinf(a) * r * 0.7f);
+        FastTrig::Angle a = i * FastTrig::fromRadians(0.62f) + orbit;
+        float r = 8.0f + 7.0f * (0.5f + 0.5f * FastTrig::sin(breathe + i * FastTrig::fromRadians(1.0f)));
+        int16_t x = ROSE_CX + (int16_t)(FastTrig::cos(a) * r);
+        int16_t y = ROSE_CY - 4 + (int16_t)(FastTrig::sin(a) * r * 0.7f);
         if (((t / 120) + i) % 3 == 0) {
             drawPixelSafe(x, y, dimColor(SPARKLE, 0.75f));
         }
@@ -137,6 +137,7 @@ public:
     void update() override;
     void render() override;
     bool isRunning() const override;
+    uint16_t targetFps() const override { return 60; }   // hearts glide across the panel
     
 private:
     IDisplay* _display = nullptr;
@@ -0,0 +1,623 @@
+// Generated by the bake tool (env:native_bake): program mosq1 60
+// 216 frames, 3600 ms loop. Do not edit; re-bake instead.
+#pragma once
+
+#include "animations/BakedAnimation.h"
+
+namespace BakedClips {
+
+const uint8_t MOSQ1_DATA[] PROGMEM = {
+    0x7F, 0xB4, 0x07, 0x00, 0x00, 0x81, 0xDF, 0xF7, 0x7D, 0x00, 0x00, 0x43, 0xDF, 0xF7, 0x82, 0x00,
+    0x00, 0xDF, 0xF7, 0x7B, 0x00, 0x00, 0x82, 0xDF, 0xF7, 0xDF, 0xF7, 0x7D, 0x00, 0x00, 0x82, 0xDF,
+    0xF7, 0xDF, 0xF7, 0x7F, 0x00, 0x00, 0x00, 0x82, 0xDF, 0xF7, 0xDF, 0xF7, 0x5A, 0x00, 0x00, 0x81,
+    0xDF, 0x2B, 0x63, 0x00, 0x00, 0x43, 0xDF, 0xF7, 0x82, 0x00, 0x00, 0xDF, 0xF7, 0x55, 0x00, 0x00,
+    0x45, 0xDF, 0x2B, 0x61, 0x00, 0x00, 0x85, 0xDF, 0x2B, 0xDF, 0x2B, 0xDF, 0xF7, 0xDF, 0x2B, 0xDF,
+    0x2B, 0x55, 0x00, 0x00, 0x45, 0xDF, 0x2B, 0x61, 0x00, 0x00, 0x45, 0xDF, 0x2B, 0x54, 0x00, 0x00,
+    0x47, 0xDF, 0x2B, 0x4F, 0x00, 0x00, 0x81, 0x15, 0x12, 0x4F, 0x00, 0x00, 0x47, 0xDF, 0x2B, 0x53,
+    0x00, 0x00, 0x46, 0xDF, 0x2B, 0x50, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x4F, 0x00, 0x00, 0x46, 0xDF,
+    0x2B, 0x54, 0x00, 0x00, 0x46, 0xDF, 0x2B, 0x4D, 0x00, 0x00, 0x47, 0xDF, 0x2B, 0x4C, 0x00, 0x00,
+    0x46, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x86, 0xDF, 0x2B, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0x2B, 0xDF,
+    0xFF, 0xDF, 0x2B, 0x4B, 0x00, 0x00, 0x4B, 0xDF, 0x2B, 0x4A, 0x00, 0x00, 0x86, 0xDF, 0x2B, 0xDF,
+    0xFF, 0xDF, 0xFF, 0xDF, 0x2B, 0xDF, 0xFF, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44,
+    0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x4A, 0x00, 0x00, 0x46, 0xDF, 0x2B, 0x81, 0xDF, 0xFF, 0x46, 0xDF,
+    0x2B, 0x49, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00,
+    0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x4A, 0x00, 0x00, 0x43, 0xDF, 0x2B, 0x47,
+    0xDF, 0xFF, 0x43, 0xDF, 0x2B, 0x49, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF,
+    0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x49, 0x00, 0x00,
+    0x43, 0xDF, 0x2B, 0x49, 0xDF, 0xFF, 0x43, 0xDF, 0x2B, 0x48, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44,
+    0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF,
+    0x2B, 0x49, 0x00, 0x00, 0x43, 0xDF, 0x2B, 0x49, 0xDF, 0xFF, 0x43, 0xDF, 0x2B, 0x48, 0x00, 0x00,
+    0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44,
+    0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x49, 0x00, 0x00, 0x43, 0xDF, 0x2B, 0x49, 0xDF, 0xFF, 0x43, 0xDF,
+    0x2B, 0x48, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00,
+    0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x46, 0x00, 0x00, 0x82, 0xDF, 0x2B, 0x00,
+    0x00, 0x43, 0xDF, 0x2B, 0x4B, 0xDF, 0xFF, 0x43, 0xDF, 0x2B, 0x82, 0x00, 0x00, 0xDF, 0x2B, 0x45,
+    0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF,
+    0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x44, 0x00, 0x00, 0x48, 0xDF, 0x2B, 0x49, 0xDF, 0xFF,
+    0x48, 0xDF, 0x2B, 0x43, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54,
+    0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x4D, 0xDF, 0x2B, 0x49, 0xDF, 0xFF, 0x4C, 0xDF,
+    0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF,
+    0x84, 0xDF, 0x2B, 0xDF, 0x2B, 0xDF, 0xFF, 0xDF, 0xFF, 0x49, 0xDF, 0x2B, 0x49, 0xDF, 0xFF, 0x49,
+    0xDF, 0x2B, 0x83, 0xDF, 0xFF, 0xDF, 0x2B, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54,
+    0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x43, 0xDF, 0xFF,
+    0x45, 0xDF, 0x2B, 0x81, 0xDF, 0xFF, 0x43, 0xDF, 0x2B, 0x47, 0xDF, 0xFF, 0x43, 0xDF, 0x2B, 0x81,
+    0xDF, 0xFF, 0x45, 0xDF, 0x2B, 0x84, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF, 0x2B, 0xDF, 0x2B, 0x44, 0xDF,
+    0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x82, 0xDF, 0x2B,
+    0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x45, 0xDF, 0x2B, 0x81, 0xDF, 0xFF, 0x46, 0xDF, 0x2B, 0x81, 0xDF,
+    0xFF, 0x46, 0xDF, 0x2B, 0x81, 0xDF, 0xFF, 0x45, 0xDF, 0x2B, 0x84, 0xDF, 0xFF, 0xDF, 0xFF, 0xDF,
+    0x2B, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44,
+    0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x45, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF,
+    0x4B, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF,
+    0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF,
+    0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x44, 0xDF, 0x2B, 0x45, 0xDF, 0xFF, 0x46, 0x15,
+    0x12, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x44, 0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x82, 0xDF, 0x2B,
+    0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF,
+    0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x44, 0xDF, 0x2B, 0x45, 0xDF, 0xFF, 0x46,
+    0x15, 0x12, 0x45, 0xDF, 0xFF, 0x44, 0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B,
+    0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x82,
+    0xDF, 0x2B, 0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x44, 0xDF, 0x2B, 0x45, 0xDF, 0xFF, 0x46, 0x15, 0x12,
+    0x45, 0xDF, 0xFF, 0x44, 0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x44, 0xDF,
+    0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x82, 0xDF, 0x2B,
+    0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x44, 0xDF, 0x2B, 0x45, 0xDF, 0xFF, 0x46, 0x15, 0x12, 0x45, 0xDF,
+    0xFF, 0x44, 0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81,
+    0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B,
+    0x43, 0xDF, 0xFF, 0x44, 0xDF, 0x2B, 0x45, 0xDF, 0xFF, 0x46, 0x15, 0x12, 0x45, 0xDF, 0xFF, 0x44,
+    0xDF, 0x2B, 0x43, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81, 0xDF, 0x2B,
+    0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x4C, 0xDF,
+    0xFF, 0x46, 0x15, 0x12, 0x4C, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x81,
+    0xDF, 0x2B, 0x54, 0x00, 0x00, 0x81, 0xDF, 0x2B, 0x44, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B,
+    0x4C, 0xDF, 0xFF, 0x46, 0x15, 0x12, 0x4C, 0xDF, 0xFF, 0x82, 0xDF, 0x2B, 0xDF, 0x2B, 0x44, 0xDF,
+    0xFF, 0x81, 0xDF, 0x2B, 0x54, 0x00, 0x00, 0x53, 0xDF, 0x2B, 0x46, 0x15, 0x12, 0x53, 0xDF, 0x2B,
+    0x52, 0x00, 0x00, 0x70, 0x15, 0x12, 0x50, 0x00, 0x00, 0x70, 0x15, 0x12, 0x50, 0x00, 0x00, 0x70,
+    0x15, 0x12, 0x50, 0x00, 0x00, 0x70, 0x15, 0x12, 0x7F, 0x94, 0x01, 0x00, 0x00, 0x44, 0x5F, 0xDF,
+    0x44, 0x00, 0x00, 0x81, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x81, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x81,
+    0x5F, 0xDF, 0x43, 0x00, 0x00, 0x81, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x44, 0x5F, 0xDF, 0x44, 0x00,
+    0x00, 0x81, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x81, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x81, 0x5F, 0xDF,
+    0x57, 0x00, 0x00, 0x81, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x95, 0x5F, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xDF, 0x5F, 0xDF, 0x00, 0x00,
+    0x5F, 0xDF, 0x5F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x89, 0x5F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xDF,
+    0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x81, 0x5F, 0xDF,
+    0x57, 0x00, 0x00, 0x81, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF,
+    0x43, 0x00, 0x00, 0x89, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00,
+    0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF,
+    0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x87, 0x5F, 0xDF,
+    0x00, 0x00, 0x5F, 0xDF, 0x5F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xDF, 0x57, 0x00, 0x00, 0x44,
+    0x5F, 0xDF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x89, 0x5F, 0xDF, 0x00,
+    0x00, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43,
+    0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00,
+    0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x87, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00, 0x5F,
+    0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x57, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43,
+    0x00, 0x00, 0x45, 0x5F, 0xDF, 0x87, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00,
+    0x5F, 0xDF, 0x00, 0x00, 0x45, 0x5F, 0xDF, 0x82, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x82,
+    0x5F, 0xDF, 0x00, 0x00, 0x45, 0x5F, 0xDF, 0x86, 0x00, 0x00, 0x5F, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x5F, 0xDF, 0x5F, 0xDF, 0x57, 0x00, 0x00, 0x87, 0x5F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF,
+    0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF,
+    0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00,
+    0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x81, 0x5F, 0xDF, 0x57, 0x00,
+    0x00, 0x81, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00,
+    0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00,
+    0x5F, 0xDF, 0x43, 0x00, 0x00, 0x82, 0x5F, 0xDF, 0x00, 0x00, 0x44, 0x5F, 0xDF, 0x83, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00, 0x00, 0x83, 0x5F, 0xDF, 0x00, 0x00, 0x5F, 0xDF, 0x43, 0x00,
+    0x00, 0x81, 0x5F, 0xDF, 0x7F, 0x8D, 0x01, 0x00, 0x00, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x01, 0x81, 0x0D, 0x4B, 0x3F, 0x00, 0x81, 0x17, 0x85, 0x3F,
+    0x00, 0x81, 0x4A, 0x3A, 0x3F, 0xC0, 0x1C, 0x3F, 0xC1, 0x01, 0x82, 0xD7, 0x7C, 0xCD, 0x4A, 0x3E,
+    0x82, 0x99, 0xCE, 0xD7, 0x7C, 0x3E, 0x82, 0xD7, 0x7C, 0x2A, 0x32, 0x3F, 0xBF, 0x1C, 0x3F, 0xC1,
+    0x01, 0x81, 0xB6, 0x7C, 0x3F, 0x00, 0x82, 0x79, 0xCE, 0xB6, 0x7C, 0x3E, 0x82, 0xB6, 0x7C, 0x09,
+    0x32, 0x3F, 0xBF, 0x1C, 0x3F, 0xC1, 0x01, 0x83, 0x0E, 0x4B, 0x75, 0x74, 0xAC, 0x42, 0x3D, 0x83,
+    0x7D, 0xEF, 0x79, 0xCE, 0x75, 0x74, 0x3D, 0x83, 0xAC, 0x42, 0x75, 0x74, 0xE9, 0x31, 0x3F, 0xBE,
+    0x1C, 0x3F, 0xC1, 0x01, 0x84, 0x00, 0x00, 0xEE, 0x4A, 0x54, 0x6C, 0x8C, 0x3A, 0x3D, 0x83, 0x54,
+    0x6C, 0x99, 0xCE, 0x54, 0x6C, 0x3C, 0x84, 0x00, 0x00, 0x8C, 0x3A, 0x54, 0x6C, 0xE9, 0x29, 0x3F,
+    0xBD, 0x1C, 0x3F, 0xC2, 0x01, 0x84, 0x00, 0x00, 0xED, 0x4A, 0x33, 0x6C, 0x6B, 0x3A, 0x3B, 0x85,
+    0xFB, 0xDE, 0x7D, 0xEF, 0x33, 0x6C, 0xDA, 0xD6, 0x33, 0x6C, 0x3C, 0x84, 0x00, 0x00, 0x6B, 0x3A,
+    0x33, 0x6C, 0xC8, 0x29, 0x3F, 0xBC, 0x1C, 0x3F, 0xC3, 0x01, 0x84, 0x00, 0x00, 0xCD, 0x4A, 0x13,
+    0x6C, 0x6B, 0x3A, 0x3B, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x13, 0x6C, 0x1B, 0xDF, 0x13, 0x6C, 0x3C,
+    0x84, 0x00, 0x00, 0x6B, 0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F, 0xBB, 0x1C, 0x3F, 0xC4, 0x01, 0x84,
+    0x00, 0x00, 0xCD, 0x4A, 0x13, 0x6C, 0x6B, 0x3A, 0x3B, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x13, 0x6C,
+    0x5C, 0xE7, 0x13, 0x6C, 0x3C, 0x84, 0x00, 0x00, 0x6B, 0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F, 0xBA,
+    0x1C, 0x3F, 0xC5, 0x01, 0x84, 0x00, 0x00, 0xCD, 0x4A, 0x13, 0x6C, 0x6B, 0x3A, 0x38, 0x82, 0x99,
+    0xCE, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x13, 0x6C, 0x9D, 0xEF, 0x13, 0x6C, 0x3C,
+    0x84, 0x00, 0x00, 0x6B, 0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F, 0xB9, 0x1C, 0x3F, 0xC6, 0x01, 0x84,
+    0x00, 0x00, 0xCD, 0x4A, 0x13, 0x6C, 0x6B, 0x3A, 0x38, 0x82, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85,
+    0x00, 0x00, 0x7D, 0xEF, 0x13, 0x6C, 0xDE, 0xF7, 0x13, 0x6C, 0x3C, 0x84, 0x00, 0x00, 0x6B, 0x3A,
+    0x13, 0x6C, 0xC8, 0x29, 0x3F, 0xB8, 0x1C, 0x3F, 0xC7, 0x01, 0x84, 0x00, 0x00, 0xEE, 0x4A, 0x34,
+    0x6C, 0x6C, 0x3A, 0x36, 0x84, 0x18, 0x85, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00,
+    0x00, 0x7D, 0xEF, 0x34, 0x6C, 0xDE, 0xF7, 0x34, 0x6C, 0x3C, 0x84, 0x00, 0x00, 0x6C, 0x3A, 0x34,
+    0x6C, 0xC9, 0x29, 0x3F, 0xB7, 0x1C, 0x3F, 0xC8, 0x01, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x74, 0x74,
+    0xAC, 0x42, 0x36, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00,
+    0x7D, 0xEF, 0x74, 0x74, 0xDE, 0xF7, 0x74, 0x74, 0x3C, 0x84, 0x00, 0x00, 0xAC, 0x42, 0x74, 0x74,
+    0xE9, 0x31, 0x3F, 0xB6, 0x1C, 0x3F, 0xC9, 0x01, 0x84, 0x00, 0x00, 0x2E, 0x4B, 0x95, 0x74, 0xAC,
+    0x42, 0x34, 0x86, 0x4F, 0x53, 0x18, 0x85, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01,
+    0x85, 0x00, 0x00, 0x7D, 0xEF, 0x95, 0x74, 0xBE, 0xF7, 0x95, 0x74, 0x34, 0x81, 0x66, 0x21, 0x07,
+    0x84, 0x00, 0x00, 0xAC, 0x42, 0x95, 0x74, 0x09, 0x32, 0x3F, 0xB5, 0x1C, 0x3F, 0xCA, 0x01, 0x84,
+    0x00, 0x00, 0x2F, 0x53, 0xB6, 0x7C, 0xCD, 0x4A, 0x33, 0x87, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85,
+    0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0xB6, 0x7C,
+    0x7D, 0xEF, 0xB6, 0x7C, 0x33, 0x82, 0x00, 0x00, 0x66, 0x21, 0x07, 0x84, 0x00, 0x00, 0xCD, 0x4A,
+    0xB6, 0x7C, 0x09, 0x32, 0x3F, 0xB4, 0x1C, 0x3F, 0xCB, 0x01, 0x84, 0x00, 0x00, 0x70, 0x53, 0xF7,
+    0x7C, 0xED, 0x4A, 0x33, 0x87, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x00, 0x00, 0x99, 0xCE, 0x71,
+    0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0xF7, 0x7C, 0x3C, 0xE7, 0xF7, 0x7C, 0x33,
+    0x82, 0x00, 0x00, 0x66, 0x21, 0x07, 0x84, 0x00, 0x00, 0xED, 0x4A, 0xF7, 0x7C, 0x2A, 0x32, 0x3F,
+    0xB3, 0x1C, 0x3F, 0xCC, 0x01, 0x84, 0x00, 0x00, 0x90, 0x5B, 0x18, 0x85, 0x0E, 0x4B, 0x31, 0x89,
+    0x54, 0x6C, 0xB6, 0x7C, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C,
+    0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x18, 0x85, 0xFB, 0xDE, 0x18, 0x85, 0x33, 0x82,
+    0x00, 0x00, 0x66, 0x21, 0x07, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x18, 0x85, 0x4A, 0x3A, 0x3F, 0xB2,
+    0x1C, 0x3F, 0xCD, 0x01, 0x84, 0x00, 0x00, 0x90, 0x5B, 0x38, 0x85, 0x0E, 0x4B, 0x31, 0x89, 0x00,
+    0x00, 0xB6, 0x7C, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB,
+    0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x38, 0x85, 0xBA, 0xD6, 0x38, 0x85, 0x33, 0x82, 0x00,
+    0x00, 0x66, 0x21, 0x07, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x38, 0x85, 0x4A, 0x3A, 0x3F, 0xB1, 0x1C,
+    0x3F, 0xCE, 0x01, 0x84, 0x00, 0x00, 0xB1, 0x5B, 0x59, 0x8D, 0x2F, 0x53, 0x2F, 0x8B, 0xCD, 0x42,
+    0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x00, 0x00, 0x99, 0xCE,
+    0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x59, 0x8D, 0x99, 0xCE, 0x59, 0x8D,
+    0x33, 0x82, 0x00, 0x00, 0x66, 0x21, 0x07, 0x84, 0x00, 0x00, 0x2F, 0x53, 0x59, 0x8D, 0x4B, 0x3A,
+    0x3F, 0xB0, 0x1C, 0x3F, 0xCF, 0x01, 0x84, 0x00, 0x00, 0xB1, 0x5B, 0x59, 0x8D, 0x2F, 0x53, 0x2E,
+    0x8C, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x00, 0x00, 0x4F, 0x53, 0x18,
+    0x85, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x59,
+    0x8D, 0x79, 0xCE, 0x59, 0x8D, 0x33, 0x82, 0x00, 0x00, 0x66, 0x21, 0x07, 0x84, 0x00, 0x00, 0x2F,
+    0x53, 0x59, 0x8D, 0x4B, 0x3A, 0x3F, 0xAF, 0x1C, 0x3F, 0xD0, 0x01, 0x84, 0x00, 0x00, 0xB1, 0x5B,
+    0x59, 0x8D, 0x2F, 0x53, 0x2E, 0x8C, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C,
+    0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85,
+    0x00, 0x00, 0x7D, 0xEF, 0x59, 0x8D, 0x99, 0xCE, 0x59, 0x8D, 0x33, 0x82, 0x00, 0x00, 0x66, 0x21,
+    0x07, 0x84, 0x00, 0x00, 0x2F, 0x53, 0x59, 0x8D, 0x4B, 0x3A, 0x3F, 0xAE, 0x1C, 0x3F, 0xD1, 0x01,
+    0x84, 0x00, 0x00, 0x90, 0x5B, 0x38, 0x85, 0x0E, 0x4B, 0x2C, 0x8E, 0x91, 0x5B, 0xF2, 0x63, 0x00,
+    0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x00,
+    0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x38, 0x85, 0xBA,
+    0xD6, 0x38, 0x85, 0x33, 0x82, 0x00, 0x00, 0x66, 0x21, 0x07, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x38,
+    0x85, 0x4A, 0x3A, 0x3F, 0xAD, 0x1C, 0x3F, 0xD2, 0x01, 0x84, 0x00, 0x00, 0x90, 0x5B, 0x18, 0x85,
+    0x0E, 0x4B, 0x2C, 0x8E, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00,
+    0xB6, 0x7C, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE,
+    0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x18, 0x85, 0xFB, 0xDE, 0x18, 0x85, 0x33, 0x82, 0x00, 0x00,
+    0x66, 0x21, 0x07, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x18, 0x85, 0x4A, 0x3A, 0x3F, 0xAC, 0x1C, 0x3F,
+    0xD3, 0x01, 0x84, 0x00, 0x00, 0x70, 0x53, 0xF7, 0x7C, 0xED, 0x4A, 0x2A, 0x89, 0x4B, 0x3A, 0x91,
+    0x5B, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x03,
+    0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0xF7,
+    0x7C, 0x3C, 0xE7, 0xF7, 0x7C, 0x2A, 0x81, 0xC3, 0x10, 0x11, 0x84, 0x00, 0x00, 0xED, 0x4A, 0xF7,
+    0x7C, 0x2A, 0x32, 0x3F, 0xAB, 0x1C, 0x3F, 0xD4, 0x01, 0x84, 0x00, 0x00, 0x4F, 0x53, 0xD6, 0x7C,
+    0xCD, 0x4A, 0x29, 0x8C, 0x2F, 0x53, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00,
+    0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00, 0x00,
+    0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0xD6, 0x7C, 0x7D, 0xEF,
+    0xD6, 0x7C, 0x29, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21, 0x08, 0x84,
+    0x00, 0x00, 0xCD, 0x4A, 0xD6, 0x7C, 0x29, 0x32, 0x3F, 0xAA, 0x1C, 0x3F, 0xD5, 0x01, 0x84, 0x00,
+    0x00, 0x2E, 0x4B, 0x95, 0x74, 0xAC, 0x42, 0x29, 0x8C, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00,
+    0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18,
+    0x85, 0x01, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D,
+    0xEF, 0x95, 0x74, 0xBE, 0xF7, 0x95, 0x74, 0x29, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00,
+    0x00, 0x66, 0x21, 0x08, 0x84, 0x00, 0x00, 0xAC, 0x42, 0x95, 0x74, 0x09, 0x32, 0x3F, 0xA9, 0x1C,
+    0x3F, 0xD6, 0x01, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x74, 0x74, 0xAC, 0x42, 0x27, 0x8E, 0xED, 0x4A,
+    0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42,
+    0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00, 0x00, 0x99, 0xCE,
+    0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x74, 0x74, 0xDE, 0xF7, 0x74, 0x74,
+    0x29, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21, 0x08, 0x84, 0x00, 0x00,
+    0xAC, 0x42, 0x74, 0x74, 0xE9, 0x31, 0x3F, 0xA8, 0x1C, 0x3F, 0xD7, 0x01, 0x84, 0x00, 0x00, 0xEE,
+    0x4A, 0x34, 0x6C, 0x6C, 0x3A, 0x27, 0x8E, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91,
+    0x5B, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F,
+    0x53, 0x18, 0x85, 0x01, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00,
+    0x00, 0x7D, 0xEF, 0x34, 0x6C, 0xDE, 0xF7, 0x34, 0x6C, 0x29, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07,
+    0x82, 0x00, 0x00, 0x66, 0x21, 0x08, 0x84, 0x00, 0x00, 0x6C, 0x3A, 0x34, 0x6C, 0xC9, 0x29, 0x3F,
+    0xA7, 0x1C, 0x3F, 0xD8, 0x01, 0x84, 0x00, 0x00, 0xCD, 0x4A, 0x13, 0x6C, 0x6B, 0x3A, 0x25, 0x90,
+    0x8C, 0x42, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00,
+    0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85,
+    0x01, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF,
+    0x13, 0x6C, 0xDE, 0xF7, 0x13, 0x6C, 0x29, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00,
+    0x66, 0x21, 0x08, 0x84, 0x00, 0x00, 0x6B, 0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F, 0xA6, 0x1C, 0x3F,
+    0xD9, 0x01, 0x84, 0x00, 0x00, 0xCD, 0x4A, 0x13, 0x6C, 0x6B, 0x3A, 0x25, 0x90, 0xC8, 0x29, 0xED,
+    0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x00,
+    0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00,
+    0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x13, 0x6C, 0x9D,
+    0xEF, 0x13, 0x6C, 0x29, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21, 0x08,
+    0x84, 0x00, 0x00, 0x6B, 0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F, 0xA5, 0x1C, 0x3F, 0xDA, 0x01, 0x84,
+    0x00, 0x00, 0xCD, 0x4A, 0x13, 0x6C, 0x6B, 0x3A, 0x23, 0x92, 0x00, 0x00, 0x8C, 0x42, 0xC8, 0x29,
+    0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63,
+    0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84,
+    0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x13, 0x6C,
+    0x5C, 0xE7, 0x13, 0x6C, 0x29, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21,
+    0x08, 0x84, 0x00, 0x00, 0x6B, 0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F, 0xA4, 0x1C, 0x3F, 0xDB, 0x01,
+    0x84, 0x00, 0x00, 0xCD, 0x4A, 0x13, 0x6C, 0x6B, 0x3A, 0x22, 0x93, 0x2A, 0x32, 0x00, 0x00, 0x8C,
+    0x42, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00,
+    0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18,
+    0x85, 0x01, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D,
+    0xEF, 0x13, 0x6C, 0x1B, 0xDF, 0x13, 0x6C, 0x29, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00,
+    0x00, 0x66, 0x21, 0x08, 0x84, 0x00, 0x00, 0x6B, 0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F, 0xA3, 0x1C,
+    0x3F, 0xDC, 0x01, 0x65, 0x00, 0x00, 0x02, 0x92, 0x00, 0x00, 0x8C, 0x42, 0xC8, 0x29, 0xED, 0x4A,
+    0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00,
+    0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00, 0x00,
+    0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0xED, 0x4A, 0x33, 0x6C,
+    0x6B, 0x3A, 0x29, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21, 0x08, 0x84,
+    0x00, 0x00, 0x33, 0x6C, 0xDA, 0xD6, 0x33, 0x6C, 0x3D, 0x83, 0x6B, 0x3A, 0x33, 0x6C, 0xC8, 0x29,
+    0x3F, 0xE2, 0x1B, 0x3F, 0x81, 0x02, 0x82, 0xC8, 0x29, 0x2A, 0x32, 0x01, 0x92, 0x00, 0x00, 0x8C,
+    0x42, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00,
+    0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18,
+    0x85, 0x01, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D,
+    0xEF, 0xEE, 0x4A, 0x54, 0x6C, 0x8C, 0x3A, 0x20, 0x81, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3,
+    0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21, 0x08, 0x84, 0x00, 0x00, 0x54, 0x6C, 0x99, 0xCE, 0x54,
+    0x6C, 0x3C, 0x84, 0x00, 0x00, 0x8C, 0x3A, 0x54, 0x6C, 0xE9, 0x29, 0x3F, 0xE1, 0x1B, 0x3F, 0x82,
+    0x02, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x01, 0x92, 0x00, 0x00, 0x8C, 0x42, 0xC8, 0x29, 0xED, 0x4A,
+    0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00,
+    0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00, 0x00,
+    0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x4B, 0x75, 0x74,
+    0xAC, 0x42, 0x1F, 0x82, 0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82,
+    0x00, 0x00, 0x66, 0x21, 0x08, 0x84, 0x7D, 0xEF, 0x75, 0x74, 0x79, 0xCE, 0x75, 0x74, 0x3C, 0x84,
+    0x00, 0x00, 0xAC, 0x42, 0x75, 0x74, 0xE9, 0x31, 0x3F, 0xE0, 0x1B, 0x3F, 0x81, 0x02, 0x84, 0x00,
+    0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x02, 0x91, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00,
+    0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD,
+    0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00, 0x00, 0x99,
+    0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x02, 0x84, 0x00, 0x00, 0x2F, 0x4B, 0xB6, 0x74, 0xCD, 0x42, 0x1F,
+    0x82, 0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66,
+    0x21, 0x07, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0xB6, 0x74, 0x79, 0xCE, 0xB6, 0x74, 0x3C, 0x84, 0x00,
+    0x00, 0xCD, 0x42, 0xB6, 0x74, 0x09, 0x32, 0x3F, 0xDF, 0x1B, 0x3F, 0x81, 0x02, 0x98, 0x66, 0x21,
+    0x00, 0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29,
+    0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63,
+    0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x82,
+    0x00, 0x00, 0x99, 0xCE, 0x45, 0x00, 0x00, 0x83, 0x50, 0x53, 0xD7, 0x7C, 0xCD, 0x4A, 0x1F, 0x82,
+    0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21,
+    0x04, 0x82, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0xD7, 0x7C, 0x99, 0xCE,
+    0xD7, 0x7C, 0x3C, 0x84, 0x00, 0x00, 0xCD, 0x4A, 0xD7, 0x7C, 0x2A, 0x32, 0x3F, 0xDE, 0x1B, 0x3F,
+    0x83, 0x02, 0x97, 0x00, 0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00,
+    0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00,
+    0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18,
+    0x85, 0x01, 0x82, 0x00, 0x00, 0x99, 0xCE, 0x04, 0x84, 0x00, 0x00, 0x90, 0x5B, 0x17, 0x85, 0x0D,
+    0x4B, 0x1F, 0x82, 0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00,
+    0x00, 0x66, 0x21, 0x03, 0x83, 0x00, 0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D,
+    0xEF, 0x17, 0x85, 0xDA, 0xD6, 0x17, 0x85, 0x3C, 0x84, 0x00, 0x00, 0x0D, 0x4B, 0x17, 0x85, 0x4A,
+    0x3A, 0x3F, 0xDD, 0x1B, 0x3F, 0x81, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x90, 0x00, 0x00,
+    0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A,
+    0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x03, 0x84,
+    0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x82, 0x00, 0x00, 0x99, 0xCE, 0x04, 0x84,
+    0x00, 0x00, 0x90, 0x5B, 0x38, 0x85, 0x0E, 0x4B, 0x1F, 0x82, 0x00, 0x00, 0x41, 0x00, 0x08, 0x82,
+    0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21, 0x03, 0x83, 0x00, 0x00, 0x71, 0x8C,
+    0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x38, 0x85, 0x1B, 0xDF, 0x38, 0x85, 0x3C, 0x84,
+    0x00, 0x00, 0x0E, 0x4B, 0x38, 0x85, 0x4A, 0x3A, 0x3F, 0xDC, 0x1B, 0x3F, 0x82, 0x02, 0x82, 0x00,
+    0x00, 0x66, 0x21, 0x01, 0x92, 0x00, 0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C,
+    0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91,
+    0x5B, 0x00, 0x00, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x84, 0x00, 0x00, 0xB6, 0x7C, 0x4F,
+    0x53, 0x18, 0x85, 0x01, 0x47, 0x00, 0x00, 0x83, 0xB1, 0x5B, 0x59, 0x85, 0x2F, 0x4B, 0x1F, 0x82,
+    0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21,
+    0x03, 0x83, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0x59, 0x85,
+    0x5C, 0xE7, 0x59, 0x85, 0x3C, 0x84, 0x00, 0x00, 0x2F, 0x4B, 0x59, 0x85, 0x4B, 0x3A, 0x3F, 0xDB,
+    0x1B, 0x3F, 0x83, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x97, 0x00, 0x00, 0xC8, 0x29, 0x00,
+    0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F,
+    0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x00, 0x00, 0xCD, 0x42, 0x54,
+    0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x07, 0x64, 0x00, 0x00, 0x81, 0x41, 0x00,
+    0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x82, 0x00, 0x00, 0x66, 0x21, 0x02, 0x84, 0x00, 0x00,
+    0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x01, 0x85, 0x00, 0x00, 0x7D, 0xEF, 0xB1, 0x5B, 0x59, 0x8D,
+    0x2F, 0x53, 0x3C, 0x84, 0x00, 0x00, 0x59, 0x8D, 0x9E, 0xF7, 0x59, 0x8D, 0x3D, 0x83, 0x2F, 0x53,
+    0x59, 0x8D, 0x4B, 0x3A, 0x3F, 0x9A, 0x1B, 0x3F, 0x84, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01,
+    0x90, 0x00, 0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8,
+    0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2,
+    0x63, 0x03, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x6D, 0x00, 0x00, 0x81, 0x41, 0x00, 0x08, 0x82, 0x00,
+    0x00, 0xC3, 0x10, 0x07, 0x83, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00, 0x00, 0x99,
+    0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x02, 0x84, 0x00, 0x00, 0xB1, 0x5B, 0x59, 0x8D, 0x2F, 0x53, 0x33,
+    0x81, 0x66, 0x21, 0x08, 0x84, 0x00, 0x00, 0x59, 0x8D, 0xDE, 0xF7, 0x59, 0x8D, 0x3C, 0x84, 0x00,
+    0x00, 0x2F, 0x53, 0x59, 0x8D, 0x4B, 0x3A, 0x3F, 0x99, 0x1B, 0x3F, 0x85, 0x02, 0x82, 0x00, 0x00,
+    0x66, 0x21, 0x01, 0x92, 0x00, 0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42,
+    0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B,
+    0x00, 0x00, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x2C, 0x82,
+    0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x83, 0x00, 0x00, 0x4F, 0x53,
+    0x18, 0x85, 0x01, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x43, 0x00, 0x00, 0x83,
+    0xB1, 0x5B, 0x59, 0x8D, 0x2F, 0x53, 0x32, 0x82, 0x00, 0x00, 0x66, 0x21, 0x07, 0x85, 0x7D, 0xEF,
+    0x00, 0x00, 0x59, 0x8D, 0xDE, 0xF7, 0x59, 0x8D, 0x3C, 0x84, 0x00, 0x00, 0x2F, 0x53, 0x59, 0x8D,
+    0x4B, 0x3A, 0x3F, 0x98, 0x1B, 0x3F, 0x86, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x92, 0x00,
+    0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED,
+    0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0xCD,
+    0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x2C, 0x82, 0x00, 0x00, 0x41, 0x00, 0x08,
+    0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x83, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00,
+    0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x02, 0x84, 0x00, 0x00, 0x90, 0x5B, 0x38, 0x85, 0x0E,
+    0x4B, 0x32, 0x82, 0x00, 0x00, 0x66, 0x21, 0x06, 0x81, 0x00, 0x00, 0x01, 0x84, 0x7D, 0xEF, 0x38,
+    0x85, 0xDE, 0xF7, 0x38, 0x85, 0x3C, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x38, 0x85, 0x4A, 0x3A, 0x3F,
+    0x97, 0x1B, 0x3F, 0x87, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x92, 0x00, 0x00, 0xC8, 0x29,
+    0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00,
+    0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C,
+    0x01, 0x6F, 0x00, 0x00, 0x81, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x07, 0x83, 0xB6,
+    0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x02,
+    0x84, 0x00, 0x00, 0x90, 0x5B, 0x18, 0x85, 0x0E, 0x4B, 0x32, 0x82, 0x00, 0x00, 0x66, 0x21, 0x08,
+    0x84, 0x00, 0x00, 0x18, 0x85, 0xBE, 0xF7, 0x18, 0x85, 0x3C, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x18,
+    0x85, 0x4A, 0x3A, 0x3F, 0x96, 0x1B, 0x3F, 0x88, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x92,
+    0x00, 0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29,
+    0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63,
+    0xCD, 0x42, 0x54, 0x6C, 0x2F, 0x82, 0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10,
+    0x06, 0x84, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x82, 0x00, 0x00, 0x99, 0xCE,
+    0x45, 0x00, 0x00, 0x83, 0x50, 0x53, 0xD7, 0x7C, 0xCD, 0x4A, 0x32, 0x82, 0x00, 0x00, 0x66, 0x21,
+    0x04, 0x88, 0x71, 0x8C, 0xFB, 0xDE, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00, 0xD7, 0x7C, 0x7D, 0xEF,
+    0xD7, 0x7C, 0x3C, 0x84, 0x00, 0x00, 0xCD, 0x4A, 0xD7, 0x7C, 0x2A, 0x32, 0x3F, 0x95, 0x1B, 0x3F,
+    0x89, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x90, 0x00, 0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A,
+    0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00,
+    0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x72, 0x00, 0x00, 0x81, 0x41, 0x00, 0x08,
+    0x82, 0x00, 0x00, 0xC3, 0x10, 0x03, 0x82, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x84, 0x00, 0x00, 0xB6,
+    0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x82, 0x00, 0x00, 0x99, 0xCE, 0x04, 0x77, 0x00, 0x00, 0x81,
+    0x66, 0x21, 0x03, 0x89, 0x00, 0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00,
+    0x2F, 0x53, 0xB6, 0x7C, 0xCD, 0x4A, 0x3C, 0x84, 0x00, 0x00, 0xB6, 0x7C, 0x3C, 0xE7, 0xB6, 0x7C,
+    0x3D, 0x83, 0xCD, 0x4A, 0xB6, 0x7C, 0x09, 0x32, 0x3F, 0xD4, 0x1A, 0x3F, 0x8A, 0x02, 0x82, 0x00,
+    0x00, 0x66, 0x21, 0x01, 0x90, 0x00, 0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C,
+    0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91,
+    0x5B, 0x00, 0x00, 0xF2, 0x63, 0x31, 0x82, 0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3,
+    0x10, 0x02, 0x83, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x84, 0x00, 0x00, 0xB6, 0x7C, 0x4F,
+    0x53, 0x18, 0x85, 0x01, 0x7D, 0x00, 0x00, 0x81, 0x66, 0x21, 0x03, 0x89, 0x99, 0xCE, 0x71, 0x8C,
+    0xFB, 0xDE, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00, 0x2E, 0x4B, 0x95, 0x74, 0xAC, 0x42, 0x3C, 0x84,
+    0x00, 0x00, 0x95, 0x74, 0xFB, 0xDE, 0x95, 0x74, 0x3C, 0x84, 0x00, 0x00, 0xAC, 0x42, 0x95, 0x74,
+    0x09, 0x32, 0x3F, 0xD3, 0x1A, 0x3F, 0x8B, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x90, 0x00,
+    0x00, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED,
+    0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x31,
+    0x82, 0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x02, 0x83, 0x00, 0x00, 0xCD,
+    0x42, 0x54, 0x6C, 0x01, 0x84, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x3D, 0x82, 0x00,
+    0x00, 0x66, 0x21, 0x02, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x43, 0x00, 0x00,
+    0x83, 0xEE, 0x4A, 0x54, 0x6C, 0x8C, 0x3A, 0x3B, 0x85, 0x7D, 0xEF, 0x00, 0x00, 0x54, 0x6C, 0xBA,
+    0xD6, 0x54, 0x6C, 0x3C, 0x84, 0x00, 0x00, 0x8C, 0x3A, 0x54, 0x6C, 0xE9, 0x29, 0x3F, 0xD2, 0x1A,
+    0x3F, 0x8C, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x8E, 0x00, 0x00, 0xC8, 0x29, 0x00, 0x00,
+    0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53,
+    0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x74, 0x00, 0x00, 0x81, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00,
+    0xC3, 0x10, 0x02, 0x83, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C,
+    0x7F, 0x01, 0x00, 0x00, 0x82, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71,
+    0x8C, 0xFB, 0xDE, 0x02, 0x84, 0x00, 0x00, 0xED, 0x4A, 0x33, 0x6C, 0x6B, 0x3A, 0x33, 0x81, 0x66,
+    0x21, 0x06, 0x86, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00, 0x33, 0x6C, 0x99, 0xCE, 0x33, 0x6C, 0x3C,
+    0x84, 0x00, 0x00, 0x6B, 0x3A, 0x33, 0x6C, 0xC8, 0x29, 0x3F, 0xD1, 0x1A, 0x3F, 0x8D, 0x02, 0x82,
+    0x00, 0x00, 0x66, 0x21, 0x03, 0x8C, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00,
+    0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x33, 0x82,
+    0x00, 0x00, 0x41, 0x00, 0x08, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x01, 0x84, 0x00, 0x00, 0xF2, 0x63,
+    0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x3F, 0x00, 0x83, 0x00, 0x00, 0x4F,
+    0x53, 0x18, 0x85, 0x01, 0x82, 0x00, 0x00, 0x99, 0xCE, 0x45, 0x00, 0x00, 0x83, 0xCD, 0x4A, 0x13,
+    0x6C, 0x6B, 0x3A, 0x32, 0x82, 0x00, 0x00, 0x66, 0x21, 0x04, 0x88, 0x71, 0x8C, 0xFB, 0xDE, 0x00,
+    0x00, 0x7D, 0xEF, 0x00, 0x00, 0x13, 0x6C, 0x79, 0xCE, 0x13, 0x6C, 0x3C, 0x84, 0x00, 0x00, 0x6B,
+    0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F, 0xD0, 0x1A, 0x3F, 0x8E, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21,
+    0x00, 0x00, 0xC8, 0x29, 0x01, 0x89, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00,
+    0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x77, 0x00, 0x00, 0x81, 0x41, 0x00, 0x08, 0x87,
+    0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82,
+    0x00, 0x00, 0xB6, 0x7C, 0x37, 0x81, 0xC3, 0x10, 0x07, 0x83, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85,
+    0x01, 0x82, 0x00, 0x00, 0x99, 0xCE, 0x04, 0x77, 0x00, 0x00, 0x81, 0x66, 0x21, 0x03, 0x87, 0x00,
+    0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00, 0xCD, 0x4A, 0x01, 0x81, 0x6B,
+    0x3A, 0x3C, 0x81, 0x00, 0x00, 0x01, 0x82, 0x99, 0xCE, 0x13, 0x6C, 0x3D, 0x83, 0x6B, 0x3A, 0x13,
+    0x6C, 0xC8, 0x29, 0x3F, 0x8F, 0x1A, 0x3F, 0x8F, 0x02, 0x83, 0x00, 0x00, 0x66, 0x21, 0x00, 0x00,
+    0x01, 0x8A, 0xC8, 0x29, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29,
+    0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x36, 0x82, 0x00, 0x00, 0x41, 0x00, 0x08, 0x87, 0x00, 0x00,
+    0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x79, 0x00, 0x00,
+    0x81, 0xC3, 0x10, 0x07, 0x83, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x82, 0x00, 0x00, 0x99,
+    0xCE, 0x3A, 0x82, 0x00, 0x00, 0x66, 0x21, 0x03, 0x89, 0x00, 0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x00,
+    0x00, 0x7D, 0xEF, 0x00, 0x00, 0xCD, 0x4A, 0x13, 0x6C, 0x6B, 0x3A, 0x3C, 0x84, 0x00, 0x00, 0x13,
+    0x6C, 0xBA, 0xD6, 0x13, 0x6C, 0x3C, 0x84, 0x00, 0x00, 0x6B, 0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F,
+    0x8E, 0x1A, 0x3F, 0x90, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x03, 0x87, 0x00, 0x00, 0x2A, 0x32,
+    0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x79, 0x00, 0x00, 0x81, 0x41, 0x00,
+    0x07, 0x81, 0x2F, 0x53, 0x03, 0x84, 0x00, 0x00, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x3F, 0x02,
+    0x84, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x7D, 0x00, 0x00, 0x81, 0x66, 0x21,
+    0x03, 0x83, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x43, 0x00, 0x00, 0x83, 0xCD, 0x4A, 0x13, 0x6C,
+    0x6B, 0x3A, 0x3B, 0x85, 0x7D, 0xEF, 0x00, 0x00, 0x13, 0x6C, 0xFB, 0xDE, 0x13, 0x6C, 0x3C, 0x84,
+    0x00, 0x00, 0x6B, 0x3A, 0x13, 0x6C, 0xC8, 0x29, 0x3F, 0x8D, 0x1A, 0x3F, 0x91, 0x02, 0x84, 0x00,
+    0x00, 0x66, 0x21, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x87, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C,
+    0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x38, 0x82, 0x00, 0x00, 0x41, 0x00, 0x06, 0x87, 0x00,
+    0x00, 0x2F, 0x53, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x7C, 0x00, 0x00,
+    0x81, 0xC3, 0x10, 0x03, 0x82, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x84, 0x00, 0x00, 0xB6, 0x7C, 0x4F,
+    0x53, 0x18, 0x85, 0x3D, 0x82, 0x00, 0x00, 0x66, 0x21, 0x02, 0x84, 0x00, 0x00, 0x99, 0xCE, 0x71,
+    0x8C, 0xFB, 0xDE, 0x02, 0x84, 0x00, 0x00, 0xEE, 0x4A, 0x34, 0x6C, 0x6C, 0x3A, 0x3A, 0x86, 0x00,
+    0x00, 0x7D, 0xEF, 0x00, 0x00, 0x34, 0x6C, 0x3C, 0xE7, 0x34, 0x6C, 0x3C, 0x84, 0x00, 0x00, 0x6C,
+    0x3A, 0x34, 0x6C, 0xC9, 0x29, 0x3F, 0x8C, 0x1A, 0x3F, 0x92, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21,
+    0x00, 0x00, 0xC8, 0x29, 0x01, 0x87, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00,
+    0xC8, 0x29, 0xED, 0x4A, 0x38, 0x82, 0x00, 0x00, 0x41, 0x00, 0x06, 0x87, 0x00, 0x00, 0x2F, 0x53,
+    0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x00, 0x00, 0xF2, 0x63, 0x3B, 0x82, 0x00, 0x00, 0xC3, 0x10,
+    0x02, 0x83, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x7F, 0x01,
+    0x00, 0x00, 0x82, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x82, 0x00, 0x00, 0x99, 0xCE, 0x7B, 0x00, 0x00,
+    0x81, 0x66, 0x21, 0x04, 0x88, 0x71, 0x8C, 0xFB, 0xDE, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00, 0xEE,
+    0x4A, 0x54, 0x74, 0x8C, 0x42, 0x3C, 0x84, 0x00, 0x00, 0x54, 0x74, 0x9D, 0xEF, 0x54, 0x74, 0x3D,
+    0x83, 0x8C, 0x42, 0x54, 0x74, 0xE9, 0x31, 0x3F, 0xCB, 0x19, 0x3F, 0x93, 0x02, 0x84, 0x00, 0x00,
+    0x66, 0x21, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x84, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42,
+    0x7C, 0x00, 0x00, 0x81, 0x41, 0x00, 0x04, 0x84, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53,
+    0x03, 0x82, 0x00, 0x00, 0xF2, 0x63, 0x3F, 0x00, 0x83, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x01,
+    0x82, 0x00, 0x00, 0xB6, 0x7C, 0x3F, 0x00, 0x83, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x82,
+    0x00, 0x00, 0x99, 0xCE, 0x3A, 0x82, 0x00, 0x00, 0x66, 0x21, 0x03, 0x89, 0x00, 0x00, 0x71, 0x8C,
+    0xFB, 0xDE, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00, 0x2E, 0x4B, 0x95, 0x74, 0xAC, 0x42, 0x3C, 0x84,
+    0x00, 0x00, 0x95, 0x74, 0xBE, 0xF7, 0x95, 0x74, 0x3C, 0x84, 0x00, 0x00, 0xAC, 0x42, 0x95, 0x74,
+    0x09, 0x32, 0x3F, 0xCA, 0x19, 0x3F, 0x94, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21, 0x00, 0x00, 0xC8,
+    0x29, 0x01, 0x84, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x3B, 0x82, 0x00, 0x00, 0x41,
+    0x00, 0x03, 0x87, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x4B, 0x3A, 0x91,
+    0x5B, 0x01, 0x7D, 0x00, 0x00, 0x81, 0xC3, 0x10, 0x03, 0x83, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C,
+    0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x3F, 0x00, 0x83, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x01,
+    0x82, 0x00, 0x00, 0x99, 0xCE, 0x3A, 0x82, 0x00, 0x00, 0x66, 0x21, 0x03, 0x83, 0x00, 0x00, 0x71,
+    0x8C, 0xFB, 0xDE, 0x43, 0x00, 0x00, 0x83, 0x2F, 0x53, 0xB6, 0x7C, 0xCD, 0x4A, 0x3B, 0x85, 0x7D,
+    0xEF, 0x00, 0x00, 0xB6, 0x7C, 0xDE, 0xF7, 0xB6, 0x7C, 0x3C, 0x84, 0x00, 0x00, 0xCD, 0x4A, 0xB6,
+    0x7C, 0x09, 0x32, 0x3F, 0xC9, 0x19, 0x3F, 0x95, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21, 0x00, 0x00,
+    0xC8, 0x29, 0x01, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x7E, 0x00, 0x00, 0x81, 0x41, 0x00, 0x02, 0x88,
+    0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x4B, 0x3A, 0x91, 0x5B,
+    0x3D, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x02, 0x84, 0x00, 0x00, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C,
+    0x01, 0x7F, 0x02, 0x00, 0x00, 0x83, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x01, 0x7D, 0x00, 0x00,
+    0x81, 0x66, 0x21, 0x03, 0x83, 0x99, 0xCE, 0x71, 0x8C, 0xFB, 0xDE, 0x02, 0x84, 0x00, 0x00, 0x70,
+    0x53, 0xF7, 0x7C, 0xED, 0x4A, 0x3A, 0x86, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00, 0xF7, 0x7C, 0xDE,
+    0xF7, 0xF7, 0x7C, 0x3C, 0x84, 0x00, 0x00, 0xED, 0x4A, 0xF7, 0x7C, 0x2A, 0x32, 0x3F, 0xC8, 0x19,
+    0x3F, 0x96, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x82, 0x00, 0x00,
+    0x2A, 0x32, 0x3D, 0x82, 0x00, 0x00, 0x41, 0x00, 0x01, 0x87, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00,
+    0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x7F, 0x01, 0x00, 0x00, 0x82, 0x4B, 0x3A, 0x91,
+    0x5B, 0x01, 0x84, 0x00, 0x00, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x39, 0x81, 0xC3, 0x10, 0x07,
+    0x84, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x3D, 0x82, 0x00, 0x00, 0x66, 0x21, 0x03,
+    0x83, 0x00, 0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x85, 0x7D, 0xEF, 0x00,
+    0x00, 0x90, 0x5B, 0x18, 0x85, 0x0E, 0x4B, 0x3C, 0x84, 0x00, 0x00, 0x18, 0x85, 0xDE, 0xF7, 0x18,
+    0x85, 0x3D, 0x83, 0x0E, 0x4B, 0x18, 0x85, 0x4A, 0x3A, 0x3F, 0x87, 0x19, 0x3F, 0x97, 0x02, 0x84,
+    0x00, 0x00, 0x66, 0x21, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x3D, 0x82,
+    0x00, 0x00, 0x41, 0x00, 0x01, 0x87, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A,
+    0x00, 0x00, 0x2F, 0x53, 0x3F, 0x00, 0x83, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x01, 0x82, 0x00,
+    0x00, 0xF2, 0x63, 0x7B, 0x00, 0x00, 0x81, 0xC3, 0x10, 0x04, 0x82, 0xCD, 0x42, 0x54, 0x6C, 0x01,
+    0x82, 0x00, 0x00, 0xB6, 0x7C, 0x7F, 0x01, 0x00, 0x00, 0x84, 0x4F, 0x53, 0x18, 0x85, 0x00, 0x00,
+    0x99, 0xCE, 0x7C, 0x00, 0x00, 0x81, 0x66, 0x21, 0x04, 0x88, 0x71, 0x8C, 0xFB, 0xDE, 0x00, 0x00,
+    0x7D, 0xEF, 0x00, 0x00, 0x90, 0x5B, 0x38, 0x85, 0x0E, 0x4B, 0x3C, 0x84, 0x00, 0x00, 0x38, 0x85,
+    0x9D, 0xEF, 0x38, 0x85, 0x3C, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x38, 0x85, 0x4A, 0x3A, 0x3F, 0x86,
+    0x19, 0x3F, 0x98, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x7F, 0x02,
+    0x00, 0x00, 0x88, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00,
+    0x00, 0x2F, 0x53, 0x37, 0x81, 0x41, 0x00, 0x07, 0x83, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x01,
+    0x82, 0x00, 0x00, 0xF2, 0x63, 0x3A, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x03, 0x83, 0x00, 0x00, 0xCD,
+    0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x3F, 0x00, 0x85, 0x00, 0x00, 0x4F, 0x53,
+    0x18, 0x85, 0x00, 0x00, 0x99, 0xCE, 0x3B, 0x82, 0x00, 0x00, 0x66, 0x21, 0x03, 0x83, 0x00, 0x00,
+    0x71, 0x8C, 0xFB, 0xDE, 0x43, 0x00, 0x00, 0x83, 0xB1, 0x5B, 0x59, 0x8D, 0x2F, 0x53, 0x3B, 0x85,
+    0x7D, 0xEF, 0x00, 0x00, 0x59, 0x8D, 0x5C, 0xE7, 0x59, 0x8D, 0x3C, 0x84, 0x00, 0x00, 0x2F, 0x53,
+    0x59, 0x8D, 0x4B, 0x3A, 0x3F, 0x85, 0x19, 0x3F, 0x99, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21, 0x00,
+    0x00, 0xC8, 0x29, 0x3F, 0x02, 0x87, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x00, 0x00,
+    0xC8, 0x29, 0xED, 0x4A, 0x79, 0x00, 0x00, 0x81, 0x41, 0x00, 0x07, 0x83, 0x2F, 0x53, 0x4B, 0x3A,
+    0x91, 0x5B, 0x01, 0x82, 0x00, 0x00, 0xF2, 0x63, 0x3A, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x03, 0x83,
+    0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x3F, 0x00, 0x83, 0x00,
+    0x00, 0x4F, 0x53, 0x18, 0x85, 0x7E, 0x00, 0x00, 0x81, 0x66, 0x21, 0x02, 0x84, 0x99, 0xCE, 0x00,
+    0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x02, 0x84, 0x00, 0x00, 0xB1, 0x5B, 0x59, 0x8D, 0x2F, 0x53, 0x3A,
+    0x86, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00, 0x59, 0x8D, 0x1B, 0xDF, 0x59, 0x8D, 0x3C, 0x84, 0x00,
+    0x00, 0x2F, 0x53, 0x59, 0x8D, 0x4B, 0x3A, 0x3F, 0x84, 0x19, 0x3F, 0x9A, 0x02, 0x82, 0x00, 0x00,
+    0x66, 0x21, 0x7F, 0x02, 0x00, 0x00, 0x81, 0xC8, 0x29, 0x01, 0x87, 0x00, 0x00, 0x2A, 0x32, 0x00,
+    0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x38, 0x82, 0x00, 0x00, 0x41, 0x00, 0x06,
+    0x84, 0x00, 0x00, 0x2F, 0x53, 0x4B, 0x3A, 0x91, 0x5B, 0x01, 0x7D, 0x00, 0x00, 0x81, 0xC3, 0x10,
+    0x03, 0x83, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x7F, 0x02, 0x00, 0x00, 0x83, 0xB6, 0x7C,
+    0x4F, 0x53, 0x18, 0x85, 0x3D, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x85, 0x00, 0x00, 0x99, 0xCE,
+    0x00, 0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x83, 0x7D, 0xEF, 0x00, 0x00,
+    0xB1, 0x5B, 0x01, 0x81, 0x2F, 0x53, 0x3C, 0x81, 0x00, 0x00, 0x01, 0x82, 0xBA, 0xD6, 0x59, 0x8D,
+    0x3D, 0x83, 0x2F, 0x53, 0x59, 0x8D, 0x4B, 0x3A, 0x3F, 0xC3, 0x18, 0x3F, 0x9B, 0x02, 0x82, 0x00,
+    0x00, 0x66, 0x21, 0x3F, 0x01, 0x82, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x84, 0x00, 0x00, 0x2A, 0x32,
+    0x00, 0x00, 0x8C, 0x42, 0x7C, 0x00, 0x00, 0x81, 0x41, 0x00, 0x04, 0x86, 0xC8, 0x29, 0xED, 0x4A,
+    0x00, 0x00, 0x2F, 0x53, 0x4B, 0x3A, 0x91, 0x5B, 0x3D, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x02, 0x84,
+    0x00, 0x00, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x3F, 0x02, 0x84, 0x00, 0x00, 0xB6, 0x7C, 0x4F,
+    0x53, 0x18, 0x85, 0x3D, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x82, 0x00, 0x00, 0x99, 0xCE, 0x7F,
+    0x02, 0x00, 0x00, 0x88, 0x71, 0x8C, 0xFB, 0xDE, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00, 0x91, 0x5B,
+    0x39, 0x85, 0x0F, 0x4B, 0x3C, 0x84, 0x00, 0x00, 0x39, 0x85, 0x99, 0xCE, 0x39, 0x85, 0x3C, 0x84,
+    0x00, 0x00, 0x0F, 0x4B, 0x39, 0x85, 0x4B, 0x3A, 0x3F, 0xC2, 0x18, 0x3F, 0x9C, 0x02, 0x82, 0x00,
+    0x00, 0x66, 0x21, 0x3F, 0x01, 0x82, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x84, 0x00, 0x00, 0x2A, 0x32,
+    0x00, 0x00, 0x8C, 0x42, 0x3B, 0x82, 0x00, 0x00, 0x41, 0x00, 0x03, 0x85, 0x00, 0x00, 0xC8, 0x29,
+    0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x7F, 0x01, 0x00, 0x00, 0x82, 0x4B, 0x3A, 0x91, 0x5B, 0x01,
+    0x82, 0x00, 0x00, 0xF2, 0x63, 0x7B, 0x00, 0x00, 0x81, 0xC3, 0x10, 0x04, 0x82, 0xCD, 0x42, 0x54,
+    0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x7F, 0x01, 0x00, 0x00, 0x84, 0x4F, 0x53, 0x18, 0x85,
+    0x00, 0x00, 0x99, 0xCE, 0x3C, 0x81, 0x66, 0x21, 0x03, 0x83, 0x00, 0x00, 0x71, 0x8C, 0xFB, 0xDE,
+    0x43, 0x00, 0x00, 0x83, 0x90, 0x5B, 0x38, 0x85, 0x0E, 0x4B, 0x3B, 0x85, 0x7D, 0xEF, 0x00, 0x00,
+    0x38, 0x85, 0x79, 0xCE, 0x38, 0x85, 0x3C, 0x84, 0x00, 0x00, 0x0E, 0x4B, 0x38, 0x85, 0x4A, 0x3A,
+    0x3F, 0xC1, 0x18, 0x3F, 0x9D, 0x02, 0x7F, 0x02, 0x00, 0x00, 0x83, 0x66, 0x21, 0x00, 0x00, 0xC8,
+    0x29, 0x01, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x7E, 0x00, 0x00, 0x81, 0x41, 0x00, 0x02, 0x86, 0x8C,
+    0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x3F, 0x00, 0x83, 0x00, 0x00,
+    0x4B, 0x3A, 0x91, 0x5B, 0x01, 0x82, 0x00, 0x00, 0xF2, 0x63, 0x3A, 0x82, 0x00, 0x00, 0xC3, 0x10,
+    0x03, 0x83, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x3F, 0x00,
+    0x83, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x7E, 0x00, 0x00, 0x81, 0x66, 0x21, 0x02, 0x84, 0x99,
+    0xCE, 0x00, 0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x02, 0x7F, 0x00, 0x00, 0x00, 0x84, 0x7D, 0xEF, 0x00,
+    0x00, 0x70, 0x5B, 0xF7, 0x84, 0x3D, 0x83, 0x00, 0x00, 0xF7, 0x84, 0x79, 0xCE, 0x3E, 0x82, 0xED,
+    0x4A, 0xF7, 0x84, 0x3F, 0x81, 0x18, 0x3F, 0xDE, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21, 0x00, 0x00,
+    0xC8, 0x29, 0x01, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x3D, 0x82, 0x00, 0x00, 0x41, 0x00, 0x01, 0x85,
+    0x00, 0x00, 0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x7F, 0x02, 0x00, 0x00, 0x83, 0x2F,
+    0x53, 0x4B, 0x3A, 0x91, 0x5B, 0x01, 0x82, 0x00, 0x00, 0xF2, 0x63, 0x3A, 0x82, 0x00, 0x00, 0xC3,
+    0x10, 0x03, 0x83, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x7F, 0x02, 0x00, 0x00, 0x83, 0xB6,
+    0x7C, 0x4F, 0x53, 0x18, 0x85, 0x3D, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x82, 0x00, 0x00, 0x99,
+    0xCE, 0x7F, 0x02, 0x00, 0x00, 0x86, 0x71, 0x8C, 0xFB, 0xDE, 0x00, 0x00, 0x7D, 0xEF, 0x00, 0x00,
+    0x4F, 0x53, 0x3E, 0x82, 0x00, 0x00, 0xD6, 0x7C, 0x3E, 0x82, 0x00, 0x00, 0xCD, 0x4A, 0x3F, 0x81,
+    0x18, 0x3F, 0xDF, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x82, 0x00,
+    0x00, 0x2A, 0x32, 0x3D, 0x82, 0x00, 0x00, 0x41, 0x00, 0x01, 0x85, 0x00, 0x00, 0x8C, 0x42, 0x00,
+    0x00, 0xC8, 0x29, 0xED, 0x4A, 0x3F, 0x01, 0x84, 0x00, 0x00, 0x2F, 0x53, 0x4B, 0x3A, 0x91, 0x5B,
+    0x01, 0x7D, 0x00, 0x00, 0x81, 0xC3, 0x10, 0x03, 0x83, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x3F,
+    0x02, 0x84, 0x00, 0x00, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x3D, 0x82, 0x00, 0x00, 0x66, 0x21,
+    0x01, 0x82, 0x00, 0x00, 0x99, 0xCE, 0x3F, 0x01, 0x85, 0x00, 0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x00,
+    0x00, 0x7D, 0xEF, 0x7F, 0x75, 0x00, 0x00, 0x3F, 0xCE, 0x17, 0x3F, 0xE0, 0x02, 0x84, 0x00, 0x00,
+    0x66, 0x21, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x7F, 0x02, 0x00, 0x00, 0x86, 0x2A, 0x32, 0x00, 0x00,
+    0x8C, 0x42, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x39, 0x81, 0x41, 0x00, 0x06, 0x84, 0x00, 0x00,
+    0x2F, 0x53, 0x4B, 0x3A, 0x91, 0x5B, 0x3D, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x02, 0x82, 0x00, 0x00,
+    0xF2, 0x63, 0x7F, 0x01, 0x00, 0x00, 0x82, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6,
+    0x7C, 0x7F, 0x01, 0x00, 0x00, 0x84, 0x4F, 0x53, 0x18, 0x85, 0x00, 0x00, 0x99, 0xCE, 0x3C, 0x81,
+    0x66, 0x21, 0x03, 0x83, 0x00, 0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x7F, 0x02, 0x00, 0x00, 0x81, 0x7D,
+    0xEF, 0x3F, 0xC1, 0x18, 0x3F, 0xE1, 0x02, 0x84, 0x00, 0x00, 0x66, 0x21, 0x00, 0x00, 0xC8, 0x29,
+    0x3F, 0x02, 0x84, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x7C, 0x00, 0x00, 0x81, 0x41,
+    0x00, 0x04, 0x84, 0xC8, 0x29, 0xED, 0x4A, 0x00, 0x00, 0x2F, 0x53, 0x7F, 0x01, 0x00, 0x00, 0x82,
+    0x4B, 0x3A, 0x91, 0x5B, 0x01, 0x82, 0x00, 0x00, 0xF2, 0x63, 0x3B, 0x81, 0xC3, 0x10, 0x03, 0x83,
+    0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x3F, 0x00, 0x83, 0x00,
+    0x00, 0x4F, 0x53, 0x18, 0x85, 0x7E, 0x00, 0x00, 0x81, 0x66, 0x21, 0x02, 0x84, 0x99, 0xCE, 0x00,
+    0x00, 0x71, 0x8C, 0xFB, 0xDE, 0x3F, 0x01, 0x7F, 0x35, 0x00, 0x00, 0x3F, 0xCE, 0x17, 0x3F, 0xE2,
+    0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x7F, 0x02, 0x00, 0x00, 0x81, 0xC8, 0x29, 0x01, 0x84, 0x00,
+    0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x3B, 0x82, 0x00, 0x00, 0x41, 0x00, 0x06, 0x82, 0x00,
+    0x00, 0x2F, 0x53, 0x3F, 0x00, 0x83, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x01, 0x82, 0x00, 0x00,
+    0xF2, 0x63, 0x3A, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x03, 0x83, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C,
+    0x01, 0x7F, 0x02, 0x00, 0x00, 0x83, 0xB6, 0x7C, 0x4F, 0x53, 0x18, 0x85, 0x3D, 0x82, 0x00, 0x00,
+    0x66, 0x21, 0x01, 0x82, 0x00, 0x00, 0x99, 0xCE, 0x7F, 0x02, 0x00, 0x00, 0x82, 0x71, 0x8C, 0xFB,
+    0xDE, 0x3F, 0xC1, 0x18, 0x3F, 0xE3, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x3F, 0x01, 0x82, 0x00,
+    0x00, 0xC8, 0x29, 0x01, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x7E, 0x00, 0x00, 0x81, 0x41, 0x00, 0x02,
+    0x83, 0x8C, 0x42, 0xC8, 0x29, 0xED, 0x4A, 0x01, 0x7F, 0x02, 0x00, 0x00, 0x83, 0x2F, 0x53, 0x4B,
+    0x3A, 0x91, 0x5B, 0x01, 0x7D, 0x00, 0x00, 0x81, 0xC3, 0x10, 0x03, 0x83, 0xF2, 0x63, 0xCD, 0x42,
+    0x54, 0x6C, 0x3F, 0x02, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x7F, 0x01, 0x00, 0x00, 0x84, 0x4F, 0x53,
+    0x18, 0x85, 0x00, 0x00, 0x99, 0xCE, 0x3C, 0x81, 0x66, 0x21, 0x03, 0x82, 0x00, 0x00, 0x71, 0x8C,
+    0x3F, 0xC1, 0x18, 0x3F, 0xE4, 0x02, 0x82, 0x00, 0x00, 0x66, 0x21, 0x3F, 0x01, 0x82, 0x00, 0x00,
+    0xC8, 0x29, 0x01, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x3D, 0x82, 0x00, 0x00, 0x41, 0x00, 0x01, 0x84,
+    0x00, 0x00, 0x8C, 0x42, 0xC8, 0x29, 0xED, 0x4A, 0x3F, 0x02, 0x84, 0x00, 0x00, 0x2F, 0x53, 0x4B,
+    0x3A, 0x91, 0x5B, 0x3D, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x02, 0x82, 0x00, 0x00, 0xF2, 0x63, 0x7F,
+    0x01, 0x00, 0x00, 0x82, 0xCD, 0x42, 0x54, 0x6C, 0x01, 0x82, 0x00, 0x00, 0xB6, 0x7C, 0x3F, 0x00,
+    0x83, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x7E, 0x00, 0x00, 0x81, 0x66, 0x21, 0x02, 0x81, 0x99,
+    0xCE, 0x7F, 0x35, 0x00, 0x00, 0x3F, 0xCE, 0x17, 0x3F, 0xE5, 0x02, 0x7F, 0x02, 0x00, 0x00, 0x83,
+    0x66, 0x21, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x3D, 0x82, 0x00, 0x00,
+    0x41, 0x00, 0x01, 0x84, 0x00, 0x00, 0x8C, 0x42, 0xC8, 0x29, 0xED, 0x4A, 0x3F, 0x02, 0x82, 0x00,
+    0x00, 0x2F, 0x53, 0x7F, 0x01, 0x00, 0x00, 0x82, 0x4B, 0x3A, 0x91, 0x5B, 0x01, 0x82, 0x00, 0x00,
+    0xF2, 0x63, 0x3B, 0x81, 0xC3, 0x10, 0x03, 0x83, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x3F, 0x03,
+    0x83, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x3D, 0x82, 0x00, 0x00, 0x66, 0x21, 0x01, 0x82, 0x00,
+    0x00, 0x99, 0xCE, 0x3F, 0xC1, 0x18, 0x3F, 0xA6, 0x03, 0x84, 0x00, 0x00, 0x66, 0x21, 0x00, 0x00,
+    0xC8, 0x29, 0x01, 0x7F, 0x02, 0x00, 0x00, 0x83, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x7C, 0x00,
+    0x00, 0x81, 0x41, 0x00, 0x03, 0x82, 0xC8, 0x29, 0xED, 0x4A, 0x01, 0x82, 0x00, 0x00, 0x2F, 0x53,
+    0x3F, 0x00, 0x83, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x01, 0x82, 0x00, 0x00, 0xF2, 0x63, 0x3A,
+    0x82, 0x00, 0x00, 0xC3, 0x10, 0x03, 0x83, 0x00, 0x00, 0xCD, 0x42, 0x54, 0x6C, 0x7F, 0x02, 0x00,
+    0x00, 0x84, 0xB6, 0x7C, 0x00, 0x00, 0x4F, 0x53, 0x18, 0x85, 0x3D, 0x82, 0x00, 0x00, 0x66, 0x21,
+    0x01, 0x7F, 0x35, 0x00, 0x00, 0x3F, 0xCE, 0x17, 0x3F, 0xA7, 0x03, 0x84, 0x00, 0x00, 0x66, 0x21,
+    0x00, 0x00, 0xC8, 0x29, 0x3F, 0x02, 0x84, 0x00, 0x00, 0x2A, 0x32, 0x00, 0x00, 0x8C, 0x42, 0x3B,
+    0x82, 0x00, 0x00, 0x41, 0x00, 0x02, 0x83, 0x00, 0x00, 0xC8, 0x29, 0xED, 0x4A, 0x01, 0x82, 0x00,
+    0x00, 0x2F, 0x53, 0x3F, 0x00, 0x83, 0x00, 0x00, 0x4B, 0x3A, 0x91, 0x5B, 0x01, 0x7D, 0x00, 0x00,
+    0x81, 0xC3, 0x10, 0x03, 0x83, 0xF2, 0x63, 0xCD, 0x42, 0x54, 0x6C, 0x3F, 0x01, 0x82, 0x00, 0x00,
+    0xB6, 0x7C, 0x7F, 0x02, 0x00, 0x00, 0x82, 0x4F, 0x53, 0x18, 0x85, 0x3E, 0x81, 0x66, 0x21, 0x3F,
+    0x82, 0x18, 0x3F, 0xA8, 0x03, 0x82, 0x00, 0x00, 0x66, 0x21, 0x7F, 0x02, 0x00, 0x00, 0x81, 0xC8,
+    0x29, 0x01, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x7E, 0x00, 0x00, 0x81, 0x41, 0x00, 0x02, 0x83, 0x8C,
+    0x42, 0xC8, 0x29, 0xED, 0x4A, 0x01, 0x7F, 0x02, 0x00, 0x00, 0x83, 0x2F, 0x53, 0x4B, 0x3A, 0x91,
+    0x5B, 0x3D, 0x82, 0x00, 0x00, 0xC3, 0x10, 0x02, 0x82, 0x00, 0x00, 0xF2, 0x63, 0x7F, 0x01, 0x00,
+    0x00, 0x84, 0xCD, 0x42, 0x54, 0x6C, 0x00, 0x00, 0xB6, 0x7C, 0x3F, 0x01, 0x82, 0x00, 0x00, 0x4F,
+    0x53, 0x3E, 0x82, 0x00, 0x00, 0x66, 0x21, 0x3F, 0x81, 0x18, 0x3F, 0xA9, 0x03, 0x82, 0x00, 0x00,
+    0x66, 0x21, 0x3F, 0x01, 0x82, 0x00, 0x00, 0xC8, 0x29, 0x01, 0x82, 0x00, 0x00, 0x2A, 0x32, 0x3D,
+    0x82, 0x00, 0x00, 0x41, 0x00, 0x01, 0x84, 0x00, 0x00, 0x8C, 0x42, 0xC8, 0x29, 0xED, 0x4A, 0x3F,
+    0x02, 0x82, 0x00, 0x00, 0x2F, 0x53, 0x7F, 0x01, 0x00, 0x00, 0x82, 0x4B, 0x3A, 0x91, 0x5B, 0x01,
+    0x82, 0x00, 0x00, 0xF2, 0x63, 0x3B, 0x81, 0xC3, 0x10, 0x03, 0x83, 0x00, 0x00, 0xCD, 0x42, 0x54,
+    0x6C, 0x7F, 0x02, 0x00, 0x00, 0x81, 0xB6, 0x7C, 0x7F, 0x35, 0x00, 0x00, 0x3F, 0xCE, 0x17, 0x3F,
+    0xAA, 0x03, 0x7F, 0xCB, 0x03, 0x00, 0x00, 0x3F, 0xCE, 0x17, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+};
+
+const uint32_t MOSQ1_OFFSETS[] PROGMEM = {
+    0, 1497, 1500, 1503, 1506, 1509, 1512, 1515,
+    1518, 1521, 1524, 1543, 1566, 1588, 1617, 1650,
+    1687, 1724, 1761, 1804, 1847, 1894, 1941, 1996,
+    2055, 2114, 2177, 2240, 2307, 2376, 2445, 2518,
+    2591, 2662, 2747, 2832, 2921, 3010, 3103, 3196,
+    3293, 3392, 3491, 3598, 3707, 3818, 3935, 4052,
+    4171, 4289, 4407, 4522, 4645, 4770, 4886, 5007,
+    5131, 5253, 5376, 5500, 5624, 5750, 5874, 5979,
+    6104, 6234, 6357, 6486, 6608, 6732, 6865, 6999,
+    7130, 7259, 7387, 7523, 7654, 7777, 7882, 7988,
+    8094, 8196, 8291, 8392, 8486, 8584, 8674, 8762,
+    8847, 8858, 8861, 8864, 8867, 8870, 8873, 8876,
+    8879, 8882, 8885, 8888, 8891, 8894, 8897, 8900,
+    8903, 8906, 8909, 8912, 8915, 8918, 8921, 8924,
+    8927, 8930, 8933, 8936, 8939, 8942, 8945, 8948,
+    8951, 8954, 8957, 8960, 8963, 8966, 8969, 8972,
+    8975, 8978, 8981, 8984, 8987, 8990, 8993, 8996,
+    8999, 9002, 9005, 9008, 9011, 9014, 9017, 9020,
+    9023, 9026, 9029, 9032, 9035, 9038, 9041, 9044,
+    9047, 9050, 9053, 9056, 9059, 9062, 9065, 9068,
+    9071, 9074, 9077, 9080, 9083, 9086, 9089, 9092,
+    9095, 9098, 9101, 9104, 9107, 9110, 9113, 9116,
+    9119, 9122, 9125, 9128, 9131, 9134, 9137, 9140,
+    9143, 9146, 9149, 9152, 9155, 9158, 9161, 9164,
+    9167, 9170, 9173, 9176, 9179, 9182, 9185, 9188,
+    9191, 9194, 9197, 9200, 9203, 9206, 9209, 9212,
+    9215, 9218, 9221, 9224, 9227, 9230, 9233, 9236,
+    9239, 9242,
+};
+
+const BakedClip MOSQ1 = {64, 64, 60, 216, MOSQ1_DATA, MOSQ1_OFFSETS};
+
+}
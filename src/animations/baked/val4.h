@@ -0,0 +1,202 @@
+// Generated by the bake tool (env:native_bake): program val4 30
+// 168 frames, 5600 ms loop. Do not edit; re-bake instead.
+#pragma once
+
+#include "animations/BakedAnimation.h"
+
+namespace BakedClips {
+
+const uint8_t VAL4_DATA[] PROGMEM = {
+    0x7F, 0xC3, 0x08, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x44, 0x00,
+    0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00,
+    0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00,
+    0x00, 0x84, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0x51, 0x00, 0x00,
+    0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x43, 0x00, 0x00, 0x81, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x43, 0x00, 0x00,
+    0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x84, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0x51, 0x00, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA,
+    0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x8F, 0xEB, 0xEA, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x86, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0xEB, 0xEA, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x82, 0xEB, 0xEA, 0xEB, 0xEA, 0x46, 0x00, 0x00, 0x82,
+    0x00, 0xE0, 0x00, 0xE0, 0x44, 0x00, 0x00, 0x82, 0x00, 0xE0, 0x00, 0xE0, 0x43, 0x00, 0x00, 0x8C,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0xEB, 0xEA, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00, 0xF8,
+    0x00, 0xF8, 0x43, 0x00, 0x00, 0x81, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x46, 0x00,
+    0x00, 0x44, 0x00, 0xE0, 0x82, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0xE0, 0x84, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0xEB, 0xEA, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB,
+    0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x43, 0x00, 0x00, 0x81, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x45,
+    0x00, 0x00, 0x4C, 0x00, 0xE0, 0x83, 0x00, 0x00, 0xEB, 0xEA, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x99,
+    0xEB, 0xEA, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00,
+    0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8,
+    0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x43, 0x00, 0x00, 0x81, 0xEB, 0xEA,
+    0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x44, 0x00, 0x00, 0x44, 0x00, 0xE0, 0x82, 0xBA, 0xD6, 0xBA,
+    0xD6, 0x48, 0x00, 0xE0, 0x82, 0x00, 0x00, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x43,
+    0x00, 0x00, 0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00,
+    0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00,
+    0x82, 0x00, 0xF8, 0x00, 0xF8, 0x43, 0x00, 0x00, 0x81, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB,
+    0xEA, 0x44, 0x00, 0x00, 0x44, 0x00, 0xE0, 0x81, 0x54, 0xA5, 0x49, 0x00, 0xE0, 0x82, 0x00, 0x00,
+    0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x43, 0x00, 0x00, 0x95, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x43, 0x00,
+    0x00, 0x81, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x44, 0x00, 0x00, 0x4E, 0x00, 0xE0,
+    0x82, 0x00, 0x00, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x43, 0x00, 0x00, 0x95, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00,
+    0xF8, 0x43, 0x00, 0x00, 0x81, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x45, 0x00, 0x00,
+    0x4C, 0x00, 0xE0, 0x83, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA,
+    0x43, 0x00, 0x00, 0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xEA, 0x00, 0x00,
+    0x00, 0x00, 0xEB, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00,
+    0x00, 0x86, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xEB, 0xEA, 0x44, 0xFF,
+    0xFF, 0x82, 0xEB, 0xEA, 0xEB, 0xEA, 0x44, 0x00, 0x00, 0x4C, 0x00, 0xE0, 0x83, 0x00, 0x00, 0x00,
+    0x00, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x43, 0x00, 0x00, 0x82, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x44, 0xEB, 0xEA, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x44, 0xEB, 0xEA, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44,
+    0x00, 0x00, 0x84, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0x45, 0x00,
+    0x00, 0x4A, 0x00, 0xE0, 0x43, 0x00, 0x00, 0x81, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA,
+    0x43, 0x00, 0x00, 0x82, 0xEB, 0xEA, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x86, 0xEB, 0xEA, 0xEB, 0xEA,
+    0x00, 0x00, 0x00, 0x00, 0xEB, 0xEA, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x85, 0xEB, 0xEA, 0xEB, 0xEA,
+    0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x84, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0xFF, 0xFF, 0x46, 0x00, 0x00, 0x48, 0x00, 0xE0, 0x44, 0x00, 0x00, 0x81, 0xEB,
+    0xEA, 0x44, 0xFF, 0xFF, 0x81, 0xEB, 0xEA, 0x44, 0x00, 0x00, 0x81, 0xEB, 0xEA, 0x44, 0xFF, 0xFF,
+    0x81, 0xEB, 0xEA, 0x44, 0x00, 0x00, 0x81, 0xEB, 0xEA, 0x44, 0xFF, 0xFF, 0x85, 0xEB, 0xEA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x51,
+    0x00, 0x00, 0x46, 0x00, 0xE0, 0x61, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00,
+    0x82, 0x00, 0xF8, 0x00, 0xF8, 0x52, 0x00, 0x00, 0x44, 0x00, 0xE0, 0x62, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x53, 0x00, 0x00, 0x82, 0x00,
+    0xE0, 0x00, 0xE0, 0x63, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF8, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x82, 0x00, 0xF8, 0x00, 0xF8, 0x44, 0x00, 0x00, 0x7C, 0x00,
+    0xF8, 0x44, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x7F, 0x83, 0x08, 0x00, 0x00, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0x96, 0x0D,
+    0x82, 0xDB, 0xDE, 0xDB, 0xDE, 0x3E, 0x81, 0x75, 0xAD, 0x3F, 0xAB, 0x11, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xD5,
+    0x0B, 0x82, 0x00, 0xE8, 0x00, 0xE8, 0x04, 0x82, 0x00, 0xE8, 0x00, 0xE8, 0x37, 0x44, 0x00, 0xE8,
+    0x02, 0x44, 0x00, 0xE8, 0x35, 0x4C, 0x00, 0xE8, 0x33, 0x44, 0x00, 0xE8, 0x82, 0x1B, 0xDF, 0x1B,
+    0xDF, 0x48, 0x00, 0xE8, 0x32, 0x44, 0x00, 0xE8, 0x81, 0x95, 0xAD, 0x49, 0x00, 0xE8, 0x32, 0x4E,
+    0x00, 0xE8, 0x33, 0x4C, 0x00, 0xE8, 0x34, 0x4C, 0x00, 0xE8, 0x35, 0x4A, 0x00, 0xE8, 0x37, 0x48,
+    0x00, 0xE8, 0x39, 0x46, 0x00, 0xE8, 0x3B, 0x44, 0x00, 0xE8, 0x3D, 0x82, 0x00, 0xE8, 0x00, 0xE8,
+    0x3F, 0xA8, 0x0D, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0x96, 0x0D, 0x82, 0x3C, 0xE7, 0x3C, 0xE7, 0x3E, 0x81, 0xB6,
+    0xB5, 0x3F, 0xAB, 0x11, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xD5, 0x0B, 0x82, 0x00, 0xF0, 0x00, 0xF0, 0x04, 0x82,
+    0x00, 0xF0, 0x00, 0xF0, 0x37, 0x44, 0x00, 0xF0, 0x02, 0x44, 0x00, 0xF0, 0x35, 0x4C, 0x00, 0xF0,
+    0x33, 0x44, 0x00, 0xF0, 0x82, 0x5C, 0xE7, 0x5C, 0xE7, 0x48, 0x00, 0xF0, 0x32, 0x44, 0x00, 0xF0,
+    0x81, 0xD6, 0xB5, 0x49, 0x00, 0xF0, 0x32, 0x4E, 0x00, 0xF0, 0x33, 0x4C, 0x00, 0xF0, 0x34, 0x4C,
+    0x00, 0xF0, 0x35, 0x4A, 0x00, 0xF0, 0x37, 0x48, 0x00, 0xF0, 0x39, 0x46, 0x00, 0xF0, 0x3B, 0x44,
+    0x00, 0xF0, 0x3D, 0x82, 0x00, 0xF0, 0x00, 0xF0, 0x3F, 0xA8, 0x0D, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0x96, 0x0D,
+    0x82, 0x7D, 0xEF, 0x7D, 0xEF, 0x3E, 0x81, 0xF7, 0xBD, 0x3F, 0xAB, 0x11, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xD5,
+    0x0B, 0x43, 0x00, 0xF8, 0x03, 0x43, 0x00, 0xF8, 0x36, 0x45, 0x00, 0xF8, 0x01, 0x45, 0x00, 0xF8,
+    0x34, 0x4D, 0x00, 0xF8, 0x32, 0x44, 0x00, 0xF8, 0x82, 0x9D, 0xEF, 0x9D, 0xEF, 0x49, 0x00, 0xF8,
+    0x31, 0x44, 0x00, 0xF8, 0x81, 0x17, 0xBE, 0x4A, 0x00, 0xF8, 0x31, 0x4F, 0x00, 0xF8, 0x32, 0x4D,
+    0x00, 0xF8, 0x33, 0x4D, 0x00, 0xF8, 0x34, 0x4B, 0x00, 0xF8, 0x36, 0x49, 0x00, 0xF8, 0x38, 0x81,
+    0x00, 0x00, 0x45, 0x00, 0xF8, 0x3B, 0x81, 0x00, 0x00, 0x43, 0x00, 0xF8, 0x3D, 0x82, 0x00, 0x00,
+    0x00, 0xF8, 0x3F, 0xA8, 0x0D, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0x96, 0x0D, 0x82, 0x7D, 0xEF, 0x7D, 0xEF, 0x3E, 0x81, 0xF7, 0xBD,
+    0x3F, 0xAB, 0x11, 0x3F, 0xD5, 0x0B, 0x82, 0x00, 0xF0, 0x00, 0xF0, 0x44, 0x00, 0x00, 0x82, 0x00,
+    0xF0, 0x00, 0xF0, 0x43, 0x00, 0x00, 0x34, 0x44, 0x00, 0xF0, 0x81, 0x00, 0x00, 0x01, 0x44, 0x00,
+    0xF0, 0x81, 0x00, 0x00, 0x34, 0x4C, 0x00, 0xF0, 0x81, 0x00, 0x00, 0x32, 0x44, 0x00, 0xF0, 0x02,
+    0x48, 0x00, 0xF0, 0x81, 0x00, 0x00, 0x31, 0x44, 0x00, 0xF0, 0x01, 0x49, 0x00, 0xF0, 0x81, 0x00,
+    0x00, 0x31, 0x4E, 0x00, 0xF0, 0x81, 0x00, 0x00, 0x32, 0x4C, 0x00, 0xF0, 0x81, 0x00, 0x00, 0x33,
+    0x4C, 0x00, 0xF0, 0x81, 0x00, 0x00, 0x34, 0x4A, 0x00, 0xF0, 0x43, 0x00, 0x00, 0x34, 0x48, 0x00,
+    0xF0, 0x44, 0x00, 0x00, 0x35, 0x46, 0x00, 0xF0, 0x3B, 0x44, 0x00, 0xF0, 0x3D, 0x82, 0x00, 0xF0,
+    0x00, 0xF0, 0x3F, 0xA8, 0x0D, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0x96, 0x0D, 0x82, 0x5C, 0xE7, 0x5C, 0xE7, 0x3E, 0x81, 0xD6, 0xB5,
+    0x3F, 0xAB, 0x11, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xD5, 0x0B, 0x82, 0x00, 0xE8, 0x00, 0xE8,
+    0x04, 0x82, 0x00, 0xE8, 0x00, 0xE8, 0x37, 0x44, 0x00, 0xE8, 0x02, 0x44, 0x00, 0xE8, 0x35, 0x4C,
+    0x00, 0xE8, 0x33, 0x44, 0x00, 0xE8, 0x82, 0x3C, 0xE7, 0x3C, 0xE7, 0x48, 0x00, 0xE8, 0x32, 0x44,
+    0x00, 0xE8, 0x81, 0xB6, 0xB5, 0x49, 0x00, 0xE8, 0x32, 0x4E, 0x00, 0xE8, 0x33, 0x4C, 0x00, 0xE8,
+    0x34, 0x4C, 0x00, 0xE8, 0x35, 0x4A, 0x00, 0xE8, 0x37, 0x48, 0x00, 0xE8, 0x39, 0x46, 0x00, 0xE8,
+    0x3B, 0x44, 0x00, 0xE8, 0x3D, 0x82, 0x00, 0xE8, 0x00, 0xE8, 0x3F, 0xA8, 0x0D, 0x3F, 0xC1, 0x1F,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0x96, 0x0D, 0x82, 0x1B, 0xDF, 0x1B, 0xDF, 0x3E, 0x81, 0x95, 0xAD, 0x3F, 0xAB, 0x11, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xD5, 0x0B,
+    0x82, 0x00, 0xE0, 0x00, 0xE0, 0x04, 0x82, 0x00, 0xE0, 0x00, 0xE0, 0x37, 0x44, 0x00, 0xE0, 0x02,
+    0x44, 0x00, 0xE0, 0x35, 0x4C, 0x00, 0xE0, 0x33, 0x44, 0x00, 0xE0, 0x02, 0x48, 0x00, 0xE0, 0x32,
+    0x44, 0x00, 0xE0, 0x01, 0x49, 0x00, 0xE0, 0x32, 0x4E, 0x00, 0xE0, 0x33, 0x4C, 0x00, 0xE0, 0x34,
+    0x4C, 0x00, 0xE0, 0x35, 0x4A, 0x00, 0xE0, 0x37, 0x48, 0x00, 0xE0, 0x39, 0x46, 0x00, 0xE0, 0x3B,
+    0x44, 0x00, 0xE0, 0x3D, 0x82, 0x00, 0xE0, 0x00, 0xE0, 0x3F, 0xA8, 0x0D, 0x3F, 0x96, 0x0D, 0x82,
+    0xDB, 0xDE, 0xDB, 0xDE, 0x3E, 0x81, 0x75, 0xAD, 0x3F, 0xAB, 0x11, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0x96, 0x0D,
+    0x82, 0xBA, 0xD6, 0xBA, 0xD6, 0x3E, 0x81, 0x54, 0xA5, 0x3F, 0xAB, 0x11, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1,
+    0x1F, 0x3F, 0x96, 0x0D, 0x82, 0xDB, 0xDE, 0xDB, 0xDE, 0x3E, 0x81, 0x75, 0xAD, 0x3F, 0xAB, 0x11,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0xC1, 0x1F, 0x3F, 0x96, 0x0D, 0x82, 0x1B, 0xDF, 0x1B, 0xDF, 0x3E, 0x81, 0x95, 0xAD, 0x3F, 0xAB,
+    0x11, 0x3F, 0xD5, 0x0B, 0x82, 0x00, 0xE8, 0x00, 0xE8, 0x04, 0x82, 0x00, 0xE8, 0x00, 0xE8, 0x37,
+    0x44, 0x00, 0xE8, 0x02, 0x44, 0x00, 0xE8, 0x35, 0x4C, 0x00, 0xE8, 0x33, 0x44, 0x00, 0xE8, 0x02,
+    0x48, 0x00, 0xE8, 0x32, 0x44, 0x00, 0xE8, 0x01, 0x49, 0x00, 0xE8, 0x32, 0x4E, 0x00, 0xE8, 0x33,
+    0x4C, 0x00, 0xE8, 0x34, 0x4C, 0x00, 0xE8, 0x35, 0x4A, 0x00, 0xE8, 0x37, 0x48, 0x00, 0xE8, 0x39,
+    0x46, 0x00, 0xE8, 0x3B, 0x44, 0x00, 0xE8, 0x3D, 0x82, 0x00, 0xE8, 0x00, 0xE8, 0x3F, 0xA8, 0x0D,
+    0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F,
+    0x96, 0x0D, 0x82, 0x3C, 0xE7, 0x3C, 0xE7, 0x3E, 0x81, 0xB6, 0xB5, 0x3F, 0xAB, 0x11, 0x3F, 0xC1,
+    0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0xC1, 0x1F, 0x3F, 0x96, 0x0D, 0x82, 0x1B, 0xDF,
+    0x1B, 0xDF, 0x3E, 0x81, 0x95, 0xAD, 0x3F, 0xAB, 0x11, 0x3F, 0xC1, 0x1F, 0x3F, 0xD5, 0x0B, 0x82,
+    0x00, 0xE0, 0x00, 0xE0, 0x04, 0x82, 0x00, 0xE0, 0x00, 0xE0, 0x37, 0x44, 0x00, 0xE0, 0x02, 0x44,
+    0x00, 0xE0, 0x35, 0x4C, 0x00, 0xE0, 0x33, 0x44, 0x00, 0xE0, 0x82, 0xDB, 0xDE, 0xDB, 0xDE, 0x48,
+    0x00, 0xE0, 0x32, 0x44, 0x00, 0xE0, 0x81, 0x75, 0xAD, 0x49, 0x00, 0xE0, 0x32, 0x4E, 0x00, 0xE0,
+    0x33, 0x4C, 0x00, 0xE0, 0x34, 0x4C, 0x00, 0xE0, 0x35, 0x4A, 0x00, 0xE0, 0x37, 0x48, 0x00, 0xE0,
+    0x39, 0x46, 0x00, 0xE0, 0x3B, 0x44, 0x00, 0xE0, 0x3D, 0x82, 0x00, 0xE0, 0x00, 0xE0, 0x3F, 0xA8,
+    0x0D, 0x3F, 0x96, 0x0D, 0x82, 0xBA, 0xD6, 0xBA, 0xD6, 0x3E, 0x81, 0x54, 0xA5, 0x3F, 0xAB, 0x11,
+    0x3F, 0xC1, 0x1F,
+};
+
+const uint32_t VAL4_OFFSETS[] PROGMEM = {
+    0, 1260, 1263, 1266, 1269, 1272, 1275, 1278,
+    1281, 1284, 1287, 1290, 1293, 1296, 1299, 1302,
+    1305, 1308, 1311, 1314, 1317, 1320, 1323, 1326,
+    1329, 1332, 1335, 1338, 1341, 1344, 1347, 1350,
+    1353, 1356, 1359, 1362, 1365, 1368, 1371, 1374,
+    1377, 1380, 1383, 1386, 1389, 1392, 1395, 1398,
+    1401, 1404, 1407, 1410, 1413, 1416, 1419, 1422,
+    1425, 1428, 1431, 1434, 1437, 1452, 1455, 1458,
+    1461, 1464, 1467, 1470, 1555, 1558, 1561, 1564,
+    1567, 1570, 1573, 1588, 1591, 1594, 1597, 1600,
+    1603, 1606, 1691, 1694, 1697, 1700, 1703, 1706,
+    1709, 1724, 1727, 1730, 1733, 1736, 1739, 1742,
+    1829, 1832, 1835, 1838, 1841, 1844, 1859, 1973,
+    1976, 1979, 1982, 1985, 1988, 2003, 2006, 2009,
+    2012, 2015, 2018, 2021, 2024, 2109, 2112, 2115,
+    2118, 2121, 2124, 2127, 2142, 2145, 2148, 2151,
+    2154, 2157, 2236, 2251, 2254, 2257, 2260, 2263,
+    2266, 2269, 2284, 2287, 2290, 2293, 2296, 2299,
+    2302, 2305, 2320, 2323, 2326, 2329, 2332, 2335,
+    2338, 2353, 2432, 2435, 2438, 2441, 2444, 2447,
+    2462, 2465, 2468, 2471, 2474, 2489, 2492, 2577,
+    2592, 2595,
+};
+
+const BakedClip VAL4 = {64, 64, 30, 168, VAL4_DATA, VAL4_OFFSETS};
+
+}
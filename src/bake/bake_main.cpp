@@ -0,0 +1,255 @@
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "animations/AnimationRegistry.h"
+#include "display/Canvas565.h"
+#include "display/FrameDelta.h"
+#include "display/AnimFile.h"
+
+/**
+ * Bake tool: `program <animation> [fps] [output.h | output.anim]`
+ *
+ * Renders one loop of a registered animation on the host at exact
+ * timestamps (SimClock) and writes it either as a header for BakedAnimation
+ * (FrameDelta keyframe plus per-frame deltas, compiled in) or as a .anim
+ * file for StreamedAnimation (copy it to data/anims/ and upload the
+ * filesystem). Either way the output is decoded again and compared with
+ * every rendered frame before it is written. The default output is
+ * src/animations/baked/<name>.h and the default rate is the animation's
+ * targetFps().
+ */
+
+namespace {
+constexpr int16_t PANEL = 64;
+constexpr size_t PIXELS = (size_t)PANEL * PANEL;
+
+using Frame = std::vector<uint16_t>;
+
+std::string upper(const std::string& s) {
+    std::string out = s;
+    for (char& c : out) c = (char)std::toupper((unsigned char)c);
+    return out;
+}
+
+std::vector<Frame> renderLoop(IAnimation& animation, uint32_t loopMs, uint16_t frameCount) {
+    Canvas565 canvas(PANEL, PANEL);
+    animation.init(&canvas);
+    SimClock::setMs(0);
+    animation.start();
+
+    std::vector<Frame> frames;
+    for (uint16_t i = 0; i < frameCount; i++) {
+        SimClock::setMs((uint32_t)((uint64_t)i * loopMs / frameCount));
+        animation.update();
+        animation.render();
+        frames.emplace_back(canvas.buffer(), canvas.buffer() + PIXELS);
+    }
+    animation.stop();
+    SimClock::useRealTime();
+    return frames;
+}
+
+// Chunk 0 is the keyframe, chunk i + 1 turns frame i - 1 (wrapping) into frame i
+std::vector<std::vector<uint8_t>> encodeLoop(const std::vector<Frame>& frames) {
+    std::vector<std::vector<uint8_t>> chunks(frames.size() + 1);
+    FrameDelta::encode(frames[0].data(), nullptr, PANEL, PANEL, chunks[0]);
+    for (size_t i = 0; i < frames.size(); i++) {
+        const Frame& previous = frames[(i + frames.size() - 1) % frames.size()];
+        FrameDelta::encode(frames[i].data(), previous.data(), PANEL, PANEL, chunks[i + 1]);
+    }
+    return chunks;
+}
+
+bool verify(const std::vector<Frame>& frames, const std::vector<std::vector<uint8_t>>& chunks) {
+    Frame decoded(PIXELS, 0xFFFF);
+    if (!FrameDelta::decode(chunks[0].data(), chunks[0].size(), decoded.data(), PANEL, PANEL) ||
+        decoded != frames[0]) {
+        std::printf("keyframe does not decode to frame 0\n");
+        return false;
+    }
+    // Twice round the loop, so the wrap delta is checked too
+    for (size_t step = 1; step <= frames.size() * 2; step++) {
+        size_t i = step % frames.size();
+        const std::vector<uint8_t>& chunk = chunks[i + 1];
+        if (!FrameDelta::decode(chunk.data(), chunk.size(), decoded.data(), PANEL, PANEL) || decoded != frames[i]) {
+            std::printf("delta %zu does not reproduce frame %zu\n", i, i);
+            return false;
+        }
+    }
+    return true;
+}
+
+// AnimFile::Reader source over the encoded bytes, for verification
+class MemorySource : public AnimFile::Reader::Source {
+public:
+    explicit MemorySource(const std::vector<uint8_t>& bytes) : _bytes(bytes) {}
+
+    bool seek(uint32_t offset) override {
+        if (offset > _bytes.size()) return false;
+        _pos = offset;
+        return true;
+    }
+
+    size_t read(uint8_t* buf, size_t maxLen) override {
+        size_t n = std::min(maxLen, _bytes.size() - _pos);
+        std::memcpy(buf, _bytes.data() + _pos, n);
+        _pos += n;
+        return n;
+    }
+
+private:
+    const std::vector<uint8_t>& _bytes;
+    size_t _pos = 0;
+};
+
+bool verifyAnim(const std::vector<Frame>& frames, const std::vector<uint8_t>& file) {
+    MemorySource source(file);
+    AnimFile::Reader reader;
+    if (!reader.open(&source)) {
+        std::printf("cannot reopen the .anim data\n");
+        return false;
+    }
+
+    // Twice round the loop, then a seek into the middle of the second keyframe span
+    Frame decoded(PIXELS, 0xFFFF);
+    for (size_t step = 0; step < frames.size() * 2; step++) {
+        size_t i = step % frames.size();
+        if (!reader.nextFrame(decoded.data()) || decoded != frames[i]) {
+            std::printf("frame %zu does not decode\n", i);
+            return false;
+        }
+    }
+    uint16_t target = (uint16_t)(frames.size() * 3 / 4);
+    std::fill(decoded.begin(), decoded.end(), 0xFFFF);
+    if (!reader.seek(target) || !reader.nextFrame(decoded.data()) || decoded != frames[target]) {
+        std::printf("seek to frame %u does not decode\n", target);
+        return false;
+    }
+    return true;
+}
+
+bool writeAnim(const std::string& path, const std::vector<Frame>& frames, uint16_t fps) {
+    // A keyframe every two seconds bounds the cost of seek()
+    AnimFile::Writer writer(PANEL, PANEL, fps, (uint16_t)(fps * 2));
+    for (const Frame& frame : frames) {
+        if (!writer.addFrame(frame.data())) {
+            std::printf("more than %u colors: cannot write a palette file\n", AnimFile::MAX_PALETTE);
+            return false;
+        }
+    }
+    std::vector<uint8_t> file = writer.finish();
+    if (!verifyAnim(frames, file)) return false;
+
+    AnimFile::Header header;
+    AnimFile::parseHeader(file.data(), header);
+    std::printf("anim %zu B, %u palette colors, keyframe every %u frames\n", file.size(), header.paletteSize,
+                header.keyframeInterval);
+
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(file.data()), (std::streamsize)file.size());
+    return (bool)out;
+}
+
+bool writeHeader(const std::string& path, const std::string& name, uint16_t fps, uint32_t loopMs,
+                 const std::vector<std::vector<uint8_t>>& chunks) {
+    std::ofstream out(path);
+    if (!out) return false;
+
+    std::string id = upper(name);
+    char line[160];
+    out << "// Generated by the bake tool (env:native_bake): program " << name << " " << fps << "\n";
+    out << "// " << (chunks.size() - 1) << " frames, " << loopMs << " ms loop. Do not edit; re-bake instead.\n";
+    out << "#pragma once\n\n#include \"animations/BakedAnimation.h\"\n\nnamespace BakedClips {\n\n";
+
+    out << "const uint8_t " << id << "_DATA[] PROGMEM = {";
+    size_t column = 0;
+    size_t total = 0;
+    for (const std::vector<uint8_t>& chunk : chunks) {
+        for (uint8_t b : chunk) {
+            if (column++ % 16 == 0) out << "\n   ";
+            std::snprintf(line, sizeof(line), " 0x%02X,", b);
+            out << line;
+        }
+        total += chunk.size();
+    }
+    out << "\n};\n\n";
+
+    out << "const uint32_t " << id << "_OFFSETS[] PROGMEM = {";
+    size_t offset = 0;
+    column = 0;
+    for (size_t i = 0; i <= chunks.size(); i++) {
+        if (column++ % 8 == 0) out << "\n   ";
+        out << " " << offset << ",";
+        if (i < chunks.size()) offset += chunks[i].size();
+    }
+    out << "\n};\n\n";
+
+    std::snprintf(line, sizeof(line), "const BakedClip %s = {%d, %d, %u, %u, %s_DATA, %s_OFFSETS};\n", id.c_str(), PANEL,
+                  PANEL, fps, (unsigned)(chunks.size() - 1), id.c_str(), id.c_str());
+    out << line << "\n}\n";
+    return (bool)out;
+}
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::printf("usage: %s <animation> [fps] [output.h]\nbakeable:", argv[0]);
+        for (uint8_t i = 0; i < AnimationRegistry::count(); i++) {
+            if (AnimationRegistry::entry(i).loopMs > 0) std::printf(" %s", AnimationRegistry::entry(i).name);
+        }
+        std::printf("\n");
+        return 1;
+    }
+
+    int index = AnimationRegistry::find(argv[1], std::strlen(argv[1]));
+    if (index == AnimationRegistry::NOT_FOUND) {
+        std::printf("unknown animation: %s\n", argv[1]);
+        return 1;
+    }
+    const AnimationRegistry::Entry& entry = AnimationRegistry::entry((uint8_t)index);
+    if (entry.loopMs == 0) {
+        std::printf("%s is not a fixed loop and cannot be baked\n", entry.name);
+        return 1;
+    }
+
+    IAnimation& animation = entry.instance();
+    uint16_t fps = argc > 2 ? (uint16_t)std::atoi(argv[2]) : animation.targetFps();
+    if (fps == 0) fps = animation.targetFps();
+    uint16_t frameCount = (uint16_t)((entry.loopMs * fps + 500) / 1000);
+    std::string path = argc > 3 ? argv[3] : std::string("src/animations/baked/") + entry.name + ".h";
+
+    std::vector<Frame> frames = renderLoop(animation, entry.loopMs, frameCount);
+
+    if (path.size() > 5 && path.compare(path.size() - 5, 5, ".anim") == 0) {
+        if (!writeAnim(path, frames, fps)) return 1;
+        std::printf("wrote %s\n", path.c_str());
+        return 0;
+    }
+
+    std::vector<std::vector<uint8_t>> chunks = encodeLoop(frames);
+    if (!verify(frames, chunks)) return 1;
+
+    size_t deltaBytes = 0;
+    size_t largest = 0;
+    for (size_t i = 1; i < chunks.size(); i++) {
+        deltaBytes += chunks[i].size();
+        if (chunks[i].size() > largest) largest = chunks[i].size();
+    }
+    size_t raw = frames.size() * PIXELS * 2;
+    size_t baked = chunks[0].size() + deltaBytes + (chunks.size() + 1) * 4;
+    std::printf("%s: %u frames at %u fps, keyframe %zu B, deltas avg %zu B / max %zu B\n", entry.name, frameCount, fps,
+                chunks[0].size(), deltaBytes / frames.size(), largest);
+    std::printf("baked %zu B vs %zu B raw (%.1fx)\n", baked, raw, (double)raw / baked);
+
+    if (!writeHeader(path, entry.name, fps, entry.loopMs, chunks)) {
+        std::printf("cannot write %s\n", path.c_str());
+        return 1;
+    }
+    std::printf("wrote %s\n", path.c_str());
+    return 0;
+}
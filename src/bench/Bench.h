@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+
+#if defined(ESP_PLATFORM)
+#include <Arduino.h>
+#endif
+
+/**
+ * Bench.h - Host-side micro-benchmark helpers for the native_bench env.
+ *
+ * Each suite lives in its own XxxBench.cpp and is registered in bench_main.cpp.
+ * Suites that also run on the ESP32-S3 (env:esp32s3_bench) print through
+ * Bench::print and read Bench::cycleCount, and are listed in bench_esp32.cpp.
+ */
+
+namespace Bench {
+    using Clock = std::chrono::steady_clock;
+
+    inline double elapsedUs(Clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    }
+
+    // Run fn() `iterations` times and return mean microseconds per call
+    template <typename Fn>
+    double timeUs(uint32_t iterations, Fn&& fn) {
+        auto start = Clock::now();
+        for (uint32_t i = 0; i < iterations; i++) fn();
+        return elapsedUs(start) / iterations;
+    }
+
+    // CPU cycle counter (CCOUNT on the ESP32); host builds have none
+#if defined(ESP_PLATFORM)
+    constexpr bool HAS_CYCLE_COUNTER = true;
+    inline uint32_t cycleCount() { return ESP.getCycleCount(); }
+#else
+    constexpr bool HAS_CYCLE_COUNTER = false;
+    inline uint32_t cycleCount() { return 0; }
+#endif
+
+    // printf to stdout on the host, to Serial (USB CDC) on the ESP32
+    inline void print(const char* fmt, ...) {
+        va_list args;
+        va_start(args, fmt);
+#if defined(ESP_PLATFORM)
+        char line[160];
+        vsnprintf(line, sizeof(line), fmt, args);
+        Serial.print(line);
+#else
+        std::vprintf(fmt, args);
+#endif
+        va_end(args);
+    }
+
+    // Keeps the optimizer from discarding results that are only measured
+    template <typename T>
+    inline void keep(const T& value) {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+
+    void runBlit();
+    void runPresent();
+    void runColor();
+    void runTrig();
+    void runEasing();
+    void runRing();
+    void runText();
+    void runLayout();
+    void runOta();
+    void runCommand();
+}
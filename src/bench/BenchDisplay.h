@@ -0,0 +1,90 @@
+#pragma once
+
+#include "display/SimulatedDisplay.h"
+
+/**
+ * SimulatedDisplay that counts every IDisplay call and the pixels it covers.
+ *
+ * With perPixelFallback set, the bulk blits decay into one drawPixel call per
+ * visible pixel, which reproduces the dispatch cost of the pre-span code path.
+ */
+class BenchDisplay : public SimulatedDisplay {
+public:
+    BenchDisplay() : SimulatedDisplay(64, 64, 1) {}
+
+    bool perPixelFallback = false;
+    uint64_t calls = 0;
+    uint64_t pixels = 0;
+
+    void resetCounters() {
+        calls = 0;
+        pixels = 0;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        calls++;
+        pixels++;
+        SimulatedDisplay::drawPixel(x, y, color);
+    }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override {
+        calls++;
+        SimulatedDisplay::drawLine(x0, y0, x1, y1, color);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        calls++;
+        pixels += w > 0 ? w : 0;
+        SimulatedDisplay::drawFastHLine(x, y, w, color);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        calls++;
+        SimulatedDisplay::drawRect(x, y, w, h, color);
+    }
+
+    void drawSpan(int16_t x, int16_t y, const uint16_t* colors, int16_t w) override {
+        if (perPixelFallback) {
+            for (int16_t i = 0; i < w; i++) {
+                int16_t px = x + i;
+                if (px >= 0 && px < width() && y >= 0 && y < height()) drawPixel(px, y, colors[i]);
+            }
+            return;
+        }
+        calls++;
+        pixels += w > 0 ? w : 0;
+        SimulatedDisplay::drawSpan(x, y, colors, w);
+    }
+
+    void drawRow(int16_t y, const uint16_t* colors) override {
+        if (perPixelFallback) {
+            drawSpan(0, y, colors, width());
+            return;
+        }
+        calls++;
+        pixels += width();
+        SimulatedDisplay::drawRow(y, colors);
+    }
+
+    void drawBitmap565(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) override {
+        if (perPixelFallback) {
+            for (int16_t row = 0; row < h; row++) drawSpan(x, y + row, bitmap + row * w, w);
+            return;
+        }
+        calls++;
+        pixels += (uint64_t)w * h;
+        SimulatedDisplay::drawBitmap565(x, y, bitmap, w, h);
+    }
+
+    void fillScreen(uint16_t color) override {
+        calls++;
+        pixels += (uint64_t)width() * height();
+        SimulatedDisplay::fillScreen(color);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+        calls++;
+        pixels += (w > 0 && h > 0) ? (uint64_t)w * h : 0;
+        SimulatedDisplay::fillRect(x, y, w, h, color);
+    }
+};
@@ -0,0 +1,66 @@
+#include <cstdio>
+
+#include "Bench.h"
+#include "BenchDisplay.h"
+#include "animations/EggChickAnimation.h"
+#include "animations/ValentineHeartbeat.h"
+#include "animations/ValentineTextOnly.h"
+#include "animations/ValentineTextChick.h"
+
+/**
+ * Span/row blit benchmark.
+ *
+ * Renders the sprite, heart and glyph heavy animations twice: once through the
+ * native span path and once with every span decayed to per-pixel drawPixel
+ * calls, and reports IDisplay calls and time per frame for each.
+ */
+
+namespace {
+constexpr uint32_t FRAMES = 2000;
+
+struct BlitResult {
+    double callsPerFrame;
+    double usPerFrame;
+};
+
+template <typename Anim>
+BlitResult measure(Anim& anim, BenchDisplay& display, bool perPixel) {
+    display.perPixelFallback = perPixel;
+    anim.init(&display);
+    anim.start();
+    anim.update();
+    anim.render();
+    display.resetCounters();
+
+    auto start = Bench::Clock::now();
+    for (uint32_t i = 0; i < FRAMES; i++) {
+        anim.update();
+        anim.render();
+    }
+    double us = Bench::elapsedUs(start);
+    anim.stop();
+
+    return {(double)display.calls / FRAMES, us / FRAMES};
+}
+
+template <typename Anim>
+void report(const char* name, Anim& anim) {
+    BenchDisplay display;
+    BlitResult pixel = measure(anim, display, true);
+    BlitResult span = measure(anim, display, false);
+
+    std::printf("%-8s %12.0f %12.0f %10.2fx %12.2f %12.2f %10.2fx\n",
+                name,
+                pixel.callsPerFrame, span.callsPerFrame, pixel.callsPerFrame / span.callsPerFrame,
+                pixel.usPerFrame, span.usPerFrame, pixel.usPerFrame / span.usPerFrame);
+}
+}
+
+void Bench::runBlit() {
+    std::printf("%-8s %12s %12s %11s %12s %12s %11s\n",
+                "anim", "calls/px", "calls/span", "drop", "us/px", "us/span", "speedup");
+    report("val1", valentineHeartbeat);
+    report("val4", valentineTextOnly);
+    report("val5", valentineTextChick);
+    report("egg", eggChickAnimation);
+}
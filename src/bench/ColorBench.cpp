@@ -0,0 +1,117 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include "Bench.h"
+#include "animations/AnimationBase.h"
+#include "animations/ColorBatch.h"
+
+/**
+ * dimColor / blendColor benchmark.
+ *
+ * First checks that the Q8 and batch variants match the float versions for
+ * every factor q/256, then times a 4096-pixel frame's worth of dims and
+ * blends through the float, Q8 scalar and each supported SIMD path.
+ */
+
+namespace {
+constexpr int16_t SPAN = 64 * 64;
+constexpr uint32_t ITERATIONS = 2000;
+
+uint16_t srcA[SPAN];
+uint16_t srcB[SPAN];
+uint16_t out[SPAN];
+uint16_t expect[SPAN];
+
+uint32_t checkScalar() {
+    uint32_t mismatches = 0;
+    for (uint32_t c = 0; c <= 0xFFFF; c++) {
+        for (uint16_t q = 0; q <= ColorUtil::Q8_ONE; q++) {
+            if (ColorUtil::dimColorQ8(c, q) != ColorUtil::dimColor(c, q / 256.0f)) mismatches++;
+        }
+    }
+    for (uint32_t i = 0; i < 200000; i++) {
+        uint16_t a = std::rand() & 0xFFFF;
+        uint16_t b = std::rand() & 0xFFFF;
+        for (uint16_t q = 0; q <= ColorUtil::Q8_ONE; q++) {
+            if (ColorUtil::blendColorQ8(a, b, q) != ColorUtil::blendColor(a, b, q / 256.0f)) mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+uint32_t checkBatch(ColorBatch::Isa isa) {
+    uint32_t mismatches = 0;
+    for (uint16_t q = 0; q <= ColorUtil::Q8_ONE; q++) {
+        // Odd length exercises the scalar tail after the vector loop
+        int16_t n = SPAN - 13;
+        ColorBatch::dimSpanQ8(isa, out, srcA, n, q);
+        for (int16_t i = 0; i < n; i++) mismatches += out[i] != ColorUtil::dimColorQ8(srcA[i], q);
+        ColorBatch::blendSpanQ8(isa, out, srcA, srcB, n, q);
+        for (int16_t i = 0; i < n; i++) mismatches += out[i] != ColorUtil::blendColorQ8(srcA[i], srcB[i], q);
+    }
+    return mismatches;
+}
+}
+
+void Bench::runColor() {
+    for (int16_t i = 0; i < SPAN; i++) {
+        srcA[i] = std::rand() & 0xFFFF;
+        srcB[i] = std::rand() & 0xFFFF;
+    }
+
+    std::printf("scalar Q8 vs float mismatches: %u\n", (unsigned)checkScalar());
+
+    const ColorBatch::Isa isas[] = {ColorBatch::Isa::SCALAR, ColorBatch::Isa::SSE2, ColorBatch::Isa::AVX2};
+    for (ColorBatch::Isa isa : isas) {
+        if (!ColorBatch::isSupported(isa)) continue;
+        std::printf("batch %-6s vs Q8 mismatches: %u\n", ColorBatch::isaName(isa), (unsigned)checkBatch(isa));
+    }
+    std::printf("active batch path: %s\n\n", ColorBatch::isaName(ColorBatch::activeIsa()));
+
+    // Vary the factor per iteration so nothing folds to a constant
+    uint32_t iter = 0;
+    auto nextQ = [&iter]() { return (uint16_t)(1 + (iter++ * 37) % 255); };
+
+    std::printf("%-14s %12s %12s\n", "path", "ns/px dim", "ns/px blend");
+
+    double floatDim = Bench::timeUs(ITERATIONS, [&]() {
+        float f = nextQ() / 256.0f;
+        for (int16_t i = 0; i < SPAN; i++) expect[i] = ColorUtil::dimColor(srcA[i], f);
+        Bench::keep(expect);
+    });
+    double floatBlend = Bench::timeUs(ITERATIONS, [&]() {
+        float t = nextQ() / 256.0f;
+        for (int16_t i = 0; i < SPAN; i++) expect[i] = ColorUtil::blendColor(srcA[i], srcB[i], t);
+        Bench::keep(expect);
+    });
+    std::printf("%-14s %12.3f %12.3f\n", "float", floatDim * 1000.0 / SPAN, floatBlend * 1000.0 / SPAN);
+
+    double q8Dim = Bench::timeUs(ITERATIONS, [&]() {
+        uint16_t q = nextQ();
+        for (int16_t i = 0; i < SPAN; i++) expect[i] = ColorUtil::dimColorQ8(srcA[i], q);
+        Bench::keep(expect);
+    });
+    double q8Blend = Bench::timeUs(ITERATIONS, [&]() {
+        uint16_t q = nextQ();
+        for (int16_t i = 0; i < SPAN; i++) expect[i] = ColorUtil::blendColorQ8(srcA[i], srcB[i], q);
+        Bench::keep(expect);
+    });
+    std::printf("%-14s %12.3f %12.3f  (%.2fx / %.2fx vs float)\n", "q8 per-pixel",
+                q8Dim * 1000.0 / SPAN, q8Blend * 1000.0 / SPAN, floatDim / q8Dim, floatBlend / q8Blend);
+
+    for (ColorBatch::Isa isa : isas) {
+        if (!ColorBatch::isSupported(isa)) continue;
+        double dim = Bench::timeUs(ITERATIONS, [&]() {
+            ColorBatch::dimSpanQ8(isa, out, srcA, SPAN, nextQ());
+            Bench::keep(out);
+        });
+        double blend = Bench::timeUs(ITERATIONS, [&]() {
+            ColorBatch::blendSpanQ8(isa, out, srcA, srcB, SPAN, nextQ());
+            Bench::keep(out);
+        });
+        char label[20];
+        std::snprintf(label, sizeof(label), "batch %s", ColorBatch::isaName(isa));
+        std::printf("%-14s %12.3f %12.3f  (%.2fx / %.2fx vs float)\n", label,
+                    dim * 1000.0 / SPAN, blend * 1000.0 / SPAN, floatDim / dim, floatBlend / blend);
+    }
+}
@@ -0,0 +1,93 @@
+#include <cstdio>
+#include <cstring>
+
+#include "Bench.h"
+#include "core/Command.h"
+#include "animations/AnimationRegistry.h"
+
+/**
+ * Command dispatch benchmark.
+ *
+ * Resolves MQTT-style payloads the way handleIncoming/parseCommand used to
+ * (trim into a Command, three strcmps for OTA, then a String copy compared
+ * against every alias in turn) and through Command::parse, which binary
+ * searches the control words and then the AnimationRegistry index.
+ * Reported as commands per second.
+ */
+
+namespace {
+constexpr uint32_t ITERATIONS = 200000;
+
+struct Payload {
+    const char* label;
+    const char* text;
+};
+
+// Early, late and missing aliases: the old chain's cost grows with position
+const Payload PAYLOADS[] = {
+    {"first alias", "ANIM:VAL1"},
+    {"mid alias", "chick1"},
+    {"last alias", "stats"},
+    {"ota", "update"},
+    {"TEXT: prefix", "TEXT: Dinner at eight <3"},
+    {"plain text", "Happy Valentine's Day!"},
+};
+
+// Previous parseCommand chain, reduced to the id it selected
+CommandId legacyLookup(const String& command) {
+    if (command == "ANIM:VAL1" || command == "val1" || command == "heartbeat" || command == "pulse") return CommandId::ANIMATION;
+    if (command == "ANIM:VAL2" || command == "val2" || command == "twohearts" || command == "love") return CommandId::ANIMATION;
+    if (command == "ANIM:VAL3" || command == "val3" || command == "letter" || command == "envelope") return CommandId::ANIMATION;
+    if (command == "ANIM:VAL4" || command == "val4" || command == "textlove" || command == "ily") return CommandId::ANIMATION;
+    if (command == "ANIM:VAL5" || command == "val5" || command == "chicklove" || command == "ilychick") return CommandId::ANIMATION;
+    if (command == "ANIM:CHICK1" || command == "chick1" || command == "cutechick") return CommandId::ANIMATION;
+    if (command == "ANIM:MOSQ1" || command == "mosq1" || command == "mosque") return CommandId::ANIMATION;
+    if (command == "egg" || command == "hatch" || command == "animation/egg_chick" || command == "chick") return CommandId::ANIMATION;
+    if (command == "stop" || command == "animation/stop" || command == "ANIM:STOP") return CommandId::STOP;
+    if (command == "STATS" || command == "stats") return CommandId::STATS;
+    if (command.startsWith("TEXT:")) {
+        String text = command.substring(5);
+        text.trim();
+        Bench::keep(text.length());
+    }
+    return CommandId::TEXT;
+}
+
+CommandId legacyDispatch(const char* payload, size_t length) {
+    Command command(payload, length);
+    if (command.empty()) return CommandId::NONE;
+    if (strcmp(command.text, "OTA:CHECK") == 0 || strcmp(command.text, "ota") == 0 || strcmp(command.text, "update") == 0) {
+        return CommandId::OTA_CHECK;
+    }
+    return legacyLookup(String(command.text));
+}
+
+CommandId tableDispatch(const char* payload, size_t length) {
+    return Command::parse(payload, length).id;
+}
+}
+
+void Bench::runCommand() {
+    std::printf("control words: %u, animations: %u\n", (unsigned)CommandTable::aliasCount(),
+                (unsigned)AnimationRegistry::count());
+    std::printf("%-14s %14s %14s %9s\n", "payload", "cmd/s legacy", "cmd/s table", "speedup");
+
+    double legacyTotal = 0;
+    double tableTotal = 0;
+    for (const Payload& p : PAYLOADS) {
+        size_t length = std::strlen(p.text);
+        if (legacyDispatch(p.text, length) != tableDispatch(p.text, length)) {
+            std::printf("MISMATCH on \"%s\"\n", p.text);
+        }
+
+        double legacy = Bench::timeUs(ITERATIONS, [&]() { Bench::keep(legacyDispatch(p.text, length)); });
+        double table = Bench::timeUs(ITERATIONS, [&]() { Bench::keep(tableDispatch(p.text, length)); });
+        legacyTotal += legacy;
+        tableTotal += table;
+        std::printf("%-14s %14.0f %14.0f %8.2fx\n", p.label, 1e6 / legacy, 1e6 / table, legacy / table);
+    }
+
+    constexpr size_t COUNT = sizeof(PAYLOADS) / sizeof(PAYLOADS[0]);
+    std::printf("%-14s %14.0f %14.0f %8.2fx\n", "mix", COUNT * 1e6 / legacyTotal, COUNT * 1e6 / tableTotal,
+                legacyTotal / tableTotal);
+}
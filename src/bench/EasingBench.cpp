@@ -0,0 +1,79 @@
+#include "Bench.h"
+#include "animations/AnimationBase.h"
+
+/**
+ * Easing benchmark, host and ESP32-S3.
+ *
+ * For each Easing:: curve, reports the worst error of the interpolated table
+ * against the analytic function at 32/64/128 segments, and the per-call cost
+ * of the analytic form and the default-size table. Curves that opt out of
+ * tabulation are timed analytic only.
+ */
+
+namespace {
+constexpr uint32_t SAMPLES = 20001;
+constexpr uint32_t REPEATS = 20;
+
+template <typename Curve, uint16_t N>
+float maxError() {
+    float worst = 0.0f;
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        float t = (float)i / (SAMPLES - 1);
+        float err = fabsf(Easing::curveTable<Curve, N>.sample(t) - Curve::analytic(t));
+        if (err > worst) worst = err;
+    }
+    return worst;
+}
+
+struct Cost {
+    double ns;
+    double cycles;
+};
+
+template <typename Fn>
+Cost measure(Fn&& fn) {
+    constexpr uint32_t calls = REPEATS * SAMPLES;
+    uint32_t c0 = Bench::cycleCount();
+    double us = Bench::timeUs(REPEATS, [&]() {
+        float acc = 0.0f;
+        for (uint32_t i = 0; i < SAMPLES; i++) acc += fn((float)i * (1.0f / (SAMPLES - 1)));
+        Bench::keep(acc);
+    });
+    uint32_t cycles = Bench::cycleCount() - c0;
+    return {us * REPEATS * 1000.0 / calls, (double)cycles / calls};
+}
+
+template <typename Curve>
+void report(const char* name) {
+    Cost analytic = measure([](float t) { return Easing::ease<Curve, false>(t); });
+    if constexpr (!Easing::tabulates<Curve>) {
+        Bench::print("%-15s %9s %9s %9s %8.2f %8s", name, "-", "-", "-", analytic.ns, "-");
+        if (Bench::HAS_CYCLE_COUNTER) Bench::print(" %8.1f %8s", analytic.cycles, "-");
+        Bench::print("   (analytic only)\n");
+        return;
+    }
+    Cost table = measure([](float t) { return Easing::ease<Curve, true>(t); });
+
+    Bench::print("%-15s %9.6f %9.6f %9.6f %8.2f %8.2f", name,
+                 maxError<Curve, 32>(), maxError<Curve, 64>(), maxError<Curve, 128>(),
+                 analytic.ns, table.ns);
+    if (Bench::HAS_CYCLE_COUNTER) Bench::print(" %8.1f %8.1f", analytic.cycles, table.cycles);
+    Bench::print("\n");
+}
+}
+
+void Bench::runEasing() {
+    Bench::print("%-15s %9s %9s %9s %8s %8s", "curve", "err@32", "err@64", "err@128", "ns fn", "ns tbl");
+    if (Bench::HAS_CYCLE_COUNTER) Bench::print(" %8s %8s", "cyc fn", "cyc tbl");
+    Bench::print("   (table size %u)\n", (unsigned)Easing::TABLE_SIZE);
+
+    report<Easing::InQuad>("easeInQuad");
+    report<Easing::OutQuad>("easeOutQuad");
+    report<Easing::InOutQuad>("easeInOutQuad");
+    report<Easing::InCubic>("easeInCubic");
+    report<Easing::OutCubic>("easeOutCubic");
+    report<Easing::InOutCubic>("easeInOutCubic");
+    report<Easing::HeartbeatPulse>("heartbeatPulse");
+    report<Easing::Breathe>("breathe");
+    report<Easing::OutBounce>("easeOutBounce");
+}
@@ -0,0 +1,77 @@
+#include <cstdio>
+
+#include "Bench.h"
+#include "display/MessageLayout.h"
+#include "display/SimulatedDisplay.h"
+
+/**
+ * Message layout benchmark.
+ *
+ * Redraws a 60-character message the way drawText used to (split into
+ * String lines on every redraw) and by replaying a MessageLayout computed
+ * once. The split alone and a single layout pass are timed too, to show what
+ * each redraw no longer pays for.
+ */
+
+namespace {
+constexpr uint32_t ITERATIONS = 50000;
+constexpr int PANEL = 64;
+
+const String MESSAGE = "Happy Valentine's Day! Dinner at eight, don't be late xoxo<3";
+
+// Previous drawText line split, verbatim apart from the display calls
+int splitLines(const String& text, String (&lines)[10]) {
+    const int charWidth = 6;
+    const int maxCharsPerLine = PANEL / charWidth;
+
+    int lineCount = 0;
+    String currentLine = "";
+    for (unsigned int i = 0; i < text.length() && lineCount < 10; i++) {
+        if (currentLine.length() >= (unsigned int)maxCharsPerLine) {
+            lines[lineCount++] = currentLine;
+            currentLine = "";
+        }
+        currentLine += text[i];
+    }
+    if (currentLine.length() > 0 && lineCount < 10) {
+        lines[lineCount++] = currentLine;
+    }
+    return lineCount;
+}
+
+void drawLegacy(IDisplay& display, const String& text) {
+    String lines[10];
+    int lineCount = splitLines(text, lines);
+    int startY = (PANEL - lineCount * 8) / 2;
+
+    display.setTextColor(0xFFFF);
+    display.setTextSize(1);
+    for (int i = 0; i < lineCount; i++) {
+        display.setCursor((PANEL - lines[i].length() * 6) / 2, startY + i * 8);
+        display.print(lines[i].c_str());
+    }
+}
+}
+
+void Bench::runLayout() {
+    std::printf("message: %u chars\n", MESSAGE.length());
+    std::printf("%-18s %12s %12s %9s\n", "work", "us legacy", "us cached", "speedup");
+
+    MessageLayout layout;
+    layout.set(MESSAGE.c_str(), PANEL, PANEL);
+
+    double split = Bench::timeUs(ITERATIONS, [&]() {
+        String lines[10];
+        Bench::keep(splitLines(MESSAGE, lines));
+    });
+    double set = Bench::timeUs(ITERATIONS, [&]() {
+        layout.set(MESSAGE.c_str(), PANEL, PANEL);
+        Bench::keep(layout.lineCount());
+    });
+    std::printf("%-18s %12.3f %12.3f %8.2fx\n", "layout", split, set, split / set);
+
+    SimulatedDisplay display(PANEL, PANEL, 1);
+    double legacy = Bench::timeUs(ITERATIONS, [&]() { drawLegacy(display, MESSAGE); });
+    double cached = Bench::timeUs(ITERATIONS, [&]() { layout.draw(&display, 0xFFFF); });
+    std::printf("%-18s %12.3f %12.3f %8.2fx\n", "redraw", legacy, cached, legacy / cached);
+}
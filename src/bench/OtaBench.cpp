@@ -0,0 +1,156 @@
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "Bench.h"
+#include "net/OtaStream.h"
+#include "net/OtaVersion.h"
+
+/**
+ * OTA pipeline check and throughput on the host.
+ *
+ * A loopback server stands in for HTTPClient's response stream: it serves an
+ * in-memory image in irregular TCP-sized pieces with gaps where nothing has
+ * arrived yet, and can truncate or stall on request. The sink checksums what
+ * it is given instead of writing flash. Time is simulated, so the stall
+ * timeout is exercised without waiting for it.
+ */
+
+namespace {
+constexpr size_t IMAGE_BYTES = 1200 * 1024;
+
+uint32_t fnv1a(const uint8_t* data, size_t len, uint32_t hash = 2166136261u) {
+    for (size_t i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+class LoopbackServer : public OtaStream::Source {
+public:
+    LoopbackServer(const std::vector<uint8_t>& body, size_t cutAt, bool stallAtCut)
+        : _body(body), _cutAt(cutAt), _stallAtCut(stallAtCut) {}
+
+    int read(uint8_t* buf, size_t maxLen) override {
+        reads++;
+        size_t end = _cutAt < _body.size() ? _cutAt : _body.size();
+        if (_pos >= end) return _stallAtCut ? 0 : -1;
+        // Every few reads nothing has arrived; otherwise up to one TCP segment
+        if (std::rand() % 5 == 0) return 0;
+        size_t n = 1 + std::rand() % 1460;
+        if (n > maxLen) n = maxLen;
+        if (n > end - _pos) n = end - _pos;
+        std::copy(_body.begin() + _pos, _body.begin() + _pos + n, buf);
+        _pos += n;
+        return (int)n;
+    }
+
+    uint32_t reads = 0;
+
+private:
+    const std::vector<uint8_t>& _body;
+    size_t _pos = 0;
+    size_t _cutAt;
+    bool _stallAtCut;
+};
+
+class ChecksumSink : public OtaStream::Sink {
+public:
+    explicit ChecksumSink(size_t failAfter = SIZE_MAX) : _failAfter(failAfter) {}
+
+    bool begin(size_t totalBytes) override { expected = totalBytes; return true; }
+    bool write(const uint8_t* data, size_t len) override {
+        if (written + len > _failAfter) return false;
+        hash = fnv1a(data, len, hash);
+        written += len;
+        largestWrite = len > largestWrite ? len : largestWrite;
+        return true;
+    }
+    bool finish() override { finished = true; return expected == 0 || written == expected; }
+    void abort() override { aborted = true; }
+
+    size_t expected = 0;
+    size_t written = 0;
+    size_t largestWrite = 0;
+    uint32_t hash = 2166136261u;
+    bool finished = false;
+    bool aborted = false;
+
+private:
+    size_t _failAfter;
+};
+
+struct Scenario {
+    const char* name;
+    bool sendLength;
+    size_t cutAt;
+    bool stallAtCut;
+    size_t sinkFailAfter;
+};
+
+const Scenario SCENARIOS[] = {
+    {"full, with length", true, SIZE_MAX, false, SIZE_MAX},
+    {"full, no length", false, SIZE_MAX, false, SIZE_MAX},
+    {"truncated", true, IMAGE_BYTES / 2, false, SIZE_MAX},
+    {"stalled", true, IMAGE_BYTES / 3, true, SIZE_MAX},
+    {"flash write fails", true, SIZE_MAX, false, 64 * 1024},
+};
+
+struct VersionCase {
+    const char* remote;
+    const char* local;
+    bool newer;
+};
+
+const VersionCase VERSION_CASES[] = {
+    {"1.2.0\n", "1.1.9", true},
+    {"1.2.0", "1.2.0", false},
+    {" 1.10.0 ", "1.9.9", true},
+    {"1.2", "1.2.0", false},
+    {"2", "1.99.99", true},
+    {"1.2.3", "1.2.4", false},
+    {"0.0.1", "dev", true},
+    {"", "0.0.0", false},
+};
+}
+
+void Bench::runOta() {
+    int agree = 0;
+    for (const VersionCase& c : VERSION_CASES) {
+        bool newer = OtaVersion::isNewer(c.remote, c.local);
+        if (newer == c.newer) agree++;
+        else std::printf("version mismatch: remote '%s' local '%s'\n", c.remote, c.local);
+    }
+    std::printf("version compare: %d/%d cases as expected\n\n", agree, (int)(sizeof(VERSION_CASES) / sizeof(VERSION_CASES[0])));
+
+    std::vector<uint8_t> image(IMAGE_BYTES);
+    std::srand(7);
+    for (uint8_t& b : image) b = (uint8_t)std::rand();
+    const uint32_t imageHash = fnv1a(image.data(), image.size());
+
+    std::printf("%-18s %-8s %-14s %9s %7s %10s %8s\n", "scenario", "state", "error", "bytes", "steps", "max chunk", "MB/s");
+    for (const Scenario& s : SCENARIOS) {
+        std::srand(42);
+        LoopbackServer server(image, s.cutAt, s.stallAtCut);
+        ChecksumSink sink(s.sinkFailAfter);
+        OtaStream stream;
+
+        uint32_t fakeMs = 0;
+        uint32_t steps = 0;
+        Bench::Clock::time_point start = Bench::Clock::now();
+        stream.begin(&server, &sink, s.sendLength ? image.size() : 0, fakeMs);
+        while (stream.step(fakeMs) == OtaStream::State::STREAMING) {
+            steps++;
+            fakeMs += 1;
+        }
+        double us = Bench::elapsedUs(start);
+
+        bool ok = stream.state() == OtaStream::State::DONE;
+        if (ok && sink.hash != imageHash) std::printf("checksum mismatch in '%s'\n", s.name);
+        std::printf("%-18s %-8s %-14s %9u %7u %10u %8.1f\n", s.name, ok ? "done" : "failed",
+                    OtaStream::errorName(stream.error()), (unsigned)stream.bytesDone(), (unsigned)steps,
+                    (unsigned)sink.largestWrite, stream.bytesDone() / us);
+    }
+    std::printf("\nbuffer per stream: %u bytes (OtaStream::CHUNK_SIZE)\n", (unsigned)OtaStream::CHUNK_SIZE);
+}
@@ -0,0 +1,67 @@
+#include <cstdio>
+
+#include "Bench.h"
+#include "BenchDisplay.h"
+#include "display/Canvas565.h"
+#include "animations/EggChickAnimation.h"
+#include "animations/ValentineHeartbeat.h"
+#include "animations/ValentineTextOnly.h"
+#include "animations/ValentineTextChick.h"
+#include "animations/Mosq1Animation.h"
+
+/**
+ * Dirty-rectangle present benchmark.
+ *
+ * Renders each animation into a Canvas565 at roughly panel frame rate and
+ * presents to a counting display, reporting rects and pixels sent per frame
+ * against the 4096 a full-frame push would cost, plus the host time spent
+ * diffing and pushing.
+ */
+
+namespace {
+constexpr uint32_t FRAMES = 300;
+constexpr uint32_t FRAME_MS = 5;
+
+template <typename Anim>
+void report(const char* name, Anim& anim) {
+    Canvas565 canvas(64, 64);
+    BenchDisplay panel;
+
+    anim.init(&canvas);
+    anim.start();
+    anim.update();
+    anim.render();
+    canvas.present(&panel);
+    panel.resetCounters();
+
+    uint64_t rects = 0;
+    uint64_t changed = 0;
+    double presentUs = 0;
+    for (uint32_t i = 0; i < FRAMES; i++) {
+        delay(FRAME_MS);
+        anim.update();
+        anim.render();
+        auto start = Bench::Clock::now();
+        canvas.present(&panel);
+        presentUs += Bench::elapsedUs(start);
+        rects += canvas.lastPresentStats().rectCount;
+        changed += canvas.lastPresentStats().pixelsChanged;
+    }
+    anim.stop();
+
+    double sent = (double)panel.pixels / FRAMES;
+    std::printf("%-8s %8.1f %10.0f %10.0f %9.1f%% %10.2f\n",
+                name, (double)rects / FRAMES, (double)changed / FRAMES, sent,
+                100.0 * sent / (64 * 64), presentUs / FRAMES);
+}
+}
+
+void Bench::runPresent() {
+    std::printf("%-8s %8s %10s %10s %10s %10s\n",
+                "anim", "rects", "changed", "sent", "of full", "us/present");
+    report("val1", valentineHeartbeat);
+    report("val4", valentineTextOnly);
+    report("val5", valentineTextChick);
+    report("mosq1", mosq1Animation);
+    report("egg", eggChickAnimation);
+}
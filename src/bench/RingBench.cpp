@@ -0,0 +1,85 @@
+#include <math.h>
+#include <cstdio>
+#include <set>
+#include <utility>
+
+#include "Bench.h"
+#include "BenchDisplay.h"
+#include "animations/Raster.h"
+
+/**
+ * Glow ring benchmark.
+ *
+ * Compares the old angle-stepped ring (0.09 rad steps, cosf/sinf, per-point
+ * clip) against Raster::strokeEllipse at the radii the heartbeat glow uses:
+ * pixels plotted, distinct pixels, double-plots, gaps in the outline and time
+ * per ring. Also times glowEllipse with a two-band halo for reference.
+ */
+
+namespace {
+constexpr uint32_t ITERATIONS = 20000;
+constexpr int16_t CX = 32;
+constexpr int16_t CY = 28;
+
+using PixelSet = std::set<std::pair<int16_t, int16_t>>;
+
+template <typename PointFn>
+void angleRing(float rad, PointFn&& fn) {
+    for (float a = 0; a < 6.28318f; a += 0.09f) {
+        fn(CX + (int16_t)(cosf(a) * rad), CY + (int16_t)(sinf(a) * rad * 0.8f));
+    }
+}
+
+// Outline pixels with fewer than two 8-neighbors are ends of a broken chain
+uint32_t countGaps(const PixelSet& pixels) {
+    uint32_t ends = 0;
+    for (const auto& p : pixels) {
+        int neighbors = 0;
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                if ((dx || dy) && pixels.count({(int16_t)(p.first + dx), (int16_t)(p.second + dy)})) neighbors++;
+            }
+        }
+        if (neighbors < 2) ends++;
+    }
+    return ends / 2;
+}
+
+void report(float rad) {
+    int16_t rx = (int16_t)(rad + 0.5f);
+    int16_t ry = (int16_t)(rad * 0.8f + 0.5f);
+
+    uint32_t oldPlotted = 0;
+    PixelSet oldSet;
+    angleRing(rad, [&](int16_t x, int16_t y) { oldPlotted++; oldSet.insert({x, y}); });
+
+    uint32_t newPlotted = 0;
+    PixelSet newSet;
+    Raster::forEachEllipsePoint(CX, CY, rx, ry, [&](int16_t x, int16_t y) { newPlotted++; newSet.insert({x, y}); });
+
+    BenchDisplay display;
+    double oldUs = Bench::timeUs(ITERATIONS, [&]() {
+        angleRing(rad, [&](int16_t x, int16_t y) {
+            if (x >= 0 && x < 64 && y >= 0 && y < 64) display.drawPixel(x, y, 0xFB2C);
+        });
+    });
+    double newUs = Bench::timeUs(ITERATIONS, [&]() {
+        Raster::strokeEllipse(&display, CX, CY, rx, ry, 0xFB2C);
+    });
+    double glowUs = Bench::timeUs(ITERATIONS, [&]() {
+        Raster::glowEllipse(&display, CX, CY, rx, ry, 0xFB2C, 2, 96);
+    });
+
+    std::printf("%5.1f  %7u %6u %5u %5u   %7u %6u %5u %5u   %8.3f %8.3f %8.3f\n", rad,
+                (unsigned)oldPlotted, (unsigned)oldSet.size(), (unsigned)(oldPlotted - oldSet.size()), (unsigned)countGaps(oldSet),
+                (unsigned)newPlotted, (unsigned)newSet.size(), (unsigned)(newPlotted - newSet.size()), (unsigned)countGaps(newSet),
+                oldUs, newUs, glowUs);
+}
+}
+
+void Bench::runRing() {
+    std::printf("%5s  %-26s   %-26s   %-26s\n", "", "------- angle loop -------", "-------- midpoint --------", "-------- us/ring ---------");
+    std::printf("%5s  %7s %6s %5s %5s   %7s %6s %5s %5s   %8s %8s %8s\n", "rad",
+                "plotted", "unique", "dup", "gaps", "plotted", "unique", "dup", "gaps", "angle", "stroke", "glow h2");
+    for (float rad = 10.0f; rad <= 40.0f; rad += 6.0f) report(rad);
+}
@@ -0,0 +1,68 @@
+#include <cstdio>
+
+#include "Bench.h"
+#include "display/GfxText.h"
+#include "display/GlyphAtlas.h"
+#include "display/SimulatedDisplay.h"
+
+/**
+ * Text rasterizer benchmark.
+ *
+ * Draws text-heavy frames through the font-walking GfxText path (bit tests
+ * plus one virtual fillRect per run) and through SimulatedDisplay's glyph
+ * atlas (lookup plus pre-expanded run fills). Text is redrawn over the same
+ * frame without clearing so only the text path is timed. Also reports the one-off cost and
+ * size of building an atlas for each text size.
+ */
+
+namespace {
+constexpr uint32_t ITERATIONS = 50000;
+
+struct Scenario {
+    const char* name;
+    uint8_t size;
+    const char* text;
+};
+
+const Scenario SCENARIOS[] = {
+    {"message 10x8", 1, "Happy Valentine's Day my love! See you at eight, don't be late. xoxo <3"},
+    {"RAMADAN", 1, "RAMADAN"},
+    {"WiFi splash", 1, "WiFi..."},
+    {"size 2 x3 lines", 2, "Eid Mubarak!"},
+    {"size 3 clock", 3, "12:34"},
+};
+
+void frame(IDisplay& display, const Scenario& s, bool atlas) {
+    if (atlas) {
+        display.setTextSize(s.size);
+        display.setTextWrap(true);
+        display.setTextColor(0xFFFF);
+        display.setCursor(0, 0);
+        display.print(s.text);
+    } else {
+        GfxText::Cursor cursor;
+        cursor.size = s.size;
+        GfxText::print(&display, cursor, s.text);
+    }
+}
+}
+
+void Bench::runText() {
+    std::printf("%-18s %12s %12s %9s\n", "frame", "us font-walk", "us atlas", "speedup");
+    SimulatedDisplay display(64, 64, 1);
+    for (const Scenario& s : SCENARIOS) {
+        double walk = Bench::timeUs(ITERATIONS, [&]() { frame(display, s, false); });
+        double atlas = Bench::timeUs(ITERATIONS, [&]() { frame(display, s, true); });
+        std::printf("%-18s %12.3f %12.3f %8.2fx\n", s.name, walk, atlas, walk / atlas);
+    }
+
+    std::printf("\n%-18s %12s %12s\n", "atlas build", "us", "bytes");
+    for (uint8_t size = 1; size <= 3; size++) {
+        double us = Bench::timeUs(200, [&]() {
+            GlyphAtlas atlas(size);
+            Bench::keep(atlas);
+        });
+        GlyphAtlas atlas(size);
+        std::printf("size %-13u %12.3f %12u\n", (unsigned)size, us, (unsigned)atlas.bytes());
+    }
+}
@@ -0,0 +1,74 @@
+#include <math.h>
+
+#include "Bench.h"
+#include "animations/FastTrig.h"
+
+/**
+ * FastTrig benchmark, host and ESP32-S3.
+ *
+ * For several table sizes, with and without interpolation, reports the worst
+ * and RMS error against sinf over all 65536 angles, then the cost per call
+ * next to sinf itself (ns everywhere, cycles where a counter exists).
+ */
+
+namespace {
+constexpr uint32_t REPEATS = 8;
+
+struct Cost {
+    double ns;
+    double cycles;
+};
+
+template <typename Fn>
+Cost measure(Fn&& fn) {
+    constexpr uint32_t calls = REPEATS * FastTrig::FULL_TURN;
+    uint32_t c0 = Bench::cycleCount();
+    double us = Bench::timeUs(REPEATS, [&]() {
+        float acc = 0.0f;
+        for (uint32_t a = 0; a < FastTrig::FULL_TURN; a++) acc += fn((FastTrig::Angle)a);
+        Bench::keep(acc);
+    });
+    uint32_t cycles = Bench::cycleCount() - c0;
+    return {us * REPEATS * 1000.0 / calls, (double)cycles / calls};
+}
+
+void printCost(const char* label, Cost cost, float maxErr, float rmsErr) {
+    if (Bench::HAS_CYCLE_COUNTER) {
+        Bench::print("%-16s %10.6f %10.6f %9.2f %9.1f\n", label, maxErr, rmsErr, cost.ns, cost.cycles);
+    } else {
+        Bench::print("%-16s %10.6f %10.6f %9.2f %9s\n", label, maxErr, rmsErr, cost.ns, "-");
+    }
+}
+
+template <uint8_t BITS, bool INTERPOLATE>
+void report(const char* label) {
+    using S = FastTrig::Sine<BITS, INTERPOLATE>;
+    double maxErr = 0.0;
+    double sumSq = 0.0;
+    for (uint32_t a = 0; a < FastTrig::FULL_TURN; a++) {
+        double exact = sin(a * (6.283185307179586 / FastTrig::FULL_TURN));
+        double err = fabs(S::q15((FastTrig::Angle)a) / 32767.0 - exact);
+        if (err > maxErr) maxErr = err;
+        sumSq += err * err;
+    }
+
+    Cost cost = measure([](FastTrig::Angle a) { return S::q15(a) * (1.0f / 32767.0f); });
+    printCost(label, cost, (float)maxErr, (float)sqrt(sumSq / FastTrig::FULL_TURN));
+}
+}
+
+void Bench::runTrig() {
+    Bench::print("%-16s %10s %10s %9s %9s\n", "variant", "max err", "rms err", "ns/call", "cyc/call");
+
+    Cost ref = measure([](FastTrig::Angle a) { return sinf(a * (6.283185307f / FastTrig::FULL_TURN)); });
+    printCost("sinf", ref, 0.0f, 0.0f);
+
+    report<8, false>("table 8 bit");
+    report<8, true>("table 8 bit lerp");
+    report<10, false>("table 10 bit");
+    report<10, true>("table 10 lerp *");
+    report<12, false>("table 12 bit");
+    report<12, true>("table 12 lerp");
+    Bench::print("(* = default, FAST_TRIG_TABLE_BITS=%d FAST_TRIG_INTERPOLATE=%d)\n",
+                 FAST_TRIG_TABLE_BITS, FAST_TRIG_INTERPOLATE);
+}
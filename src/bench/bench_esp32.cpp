@@ -0,0 +1,23 @@
+#include <Arduino.h>
+
+#include "Bench.h"
+
+/**
+ * On-target benchmark runner (env:esp32s3_bench): runs the portable suites
+ * once at boot and prints results with cycle counts over USB serial.
+ */
+
+void setup() {
+    Serial.begin(115200);
+    delay(2000);
+
+    Bench::print("== trig: FastTrig table sine accuracy and cost vs sinf (%u MHz)\n", getCpuFrequencyMhz());
+    Bench::runTrig();
+    Bench::print("== easing: Tabulated vs analytic Easing:: curves, max error and cost\n");
+    Bench::runEasing();
+    Bench::print("== done\n");
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,55 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Bench.h"
+
+/**
+ * Native benchmark runner: `program [suite ...]`, no arguments runs every suite.
+ */
+
+namespace {
+struct Suite {
+    const char* name;
+    void (*run)();
+    const char* description;
+};
+
+const Suite SUITES[] = {
+    {"blit", Bench::runBlit, "IDisplay calls and time per frame, per-pixel vs span blits"},
+    {"present", Bench::runPresent, "Dirty-rect present: rects and pixels sent per frame vs full push"},
+    {"color", Bench::runColor, "Q8 and SSE2/AVX2 dim/blend vs float ColorUtil"},
+    {"trig", Bench::runTrig, "FastTrig table sine accuracy and cost vs sinf"},
+    {"easing", Bench::runEasing, "Tabulated vs analytic Easing:: curves, max error and cost"},
+    {"ring", Bench::runRing, "Midpoint ellipse outline vs angle-stepped glow ring"},
+    {"text", Bench::runText, "Glyph atlas vs font-walking text rasterizer"},
+    {"layout", Bench::runLayout, "Cached message layout vs per-redraw String split"},
+    {"ota", Bench::runOta, "OTA version compare and chunked stream against a loopback server"},
+    {"command", Bench::runCommand, "Sorted command table vs String alias chain, commands per second"},
+};
+}
+
+int main(int argc, char** argv) {
+    std::srand(12345);
+
+    bool ranAny = false;
+    for (const Suite& suite : SUITES) {
+        bool selected = (argc < 2);
+        for (int i = 1; i < argc && !selected; i++) {
+            selected = std::strcmp(argv[i], suite.name) == 0;
+        }
+        if (!selected) continue;
+
+        std::printf("== %s: %s\n", suite.name, suite.description);
+        suite.run();
+        std::printf("\n");
+        ranAny = true;
+    }
+
+    if (!ranAny) {
+        std::printf("Unknown suite. Available:\n");
+        for (const Suite& suite : SUITES) std::printf("  %-10s %s\n", suite.name, suite.description);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+#include <string.h>
+#include "CommandTable.h"
+
+/**
+ * Command - one text command (MQTT payload or Serial line) in fixed storage,
+ * so it can cross from the network task to the render task through an
+ * SpscQueue without heap allocation. Longer input is truncated.
+ *
+ * parse() resolves the command once on the receiving side; the render task
+ * then switches on id and only reads text for CommandId::TEXT.
+ */
+struct Command {
+    static constexpr size_t MAX_LEN = 127;
+
+    char text[MAX_LEN + 1] = {0};
+    uint8_t length = 0;
+    CommandId id = CommandId::TEXT;
+    uint8_t animation = 0;     // AnimationRegistry index for CommandId::ANIMATION
+
+    Command() = default;
+
+    // Copies text with surrounding whitespace removed
+    Command(const char* src, size_t len) {
+        while (len > 0 && isSpace(src[0])) { src++; len--; }
+        while (len > 0 && isSpace(src[len - 1])) len--;
+        if (len > MAX_LEN) len = MAX_LEN;
+        memcpy(text, src, len);
+        text[len] = '\0';
+        length = (uint8_t)len;
+    }
+
+    // Looks the payload up in CommandTable; text keeps only the message argument
+    static Command parse(const char* src, size_t len) {
+        CommandTable::Parsed parsed = CommandTable::parse(src, len);
+        Command command(parsed.arg, parsed.argLen);
+        command.id = parsed.id;
+        command.animation = parsed.animation;
+        return command;
+    }
+
+    bool empty() const { return length == 0; }
+
+private:
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+};
@@ -0,0 +1,72 @@
+#include "CommandTable.h"
+#include "animations/AnimationRegistry.h"
+
+#include <string.h>
+
+namespace {
+constexpr auto ALIASES = WordIndex::sorted(CommandTable::CONTROL_WORDS);
+static_assert(WordIndex::strictlyIncreasing(ALIASES), "command aliases must be unique");
+
+constexpr char TEXT_PREFIX[] = "TEXT:";
+constexpr size_t TEXT_PREFIX_LEN = sizeof(TEXT_PREFIX) - 1;
+constexpr char FILE_PREFIX[] = "FILE:";
+constexpr size_t FILE_PREFIX_LEN = sizeof(FILE_PREFIX) - 1;
+
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+inline void trim(const char*& data, size_t& len) {
+    while (len > 0 && isSpace(data[0])) { data++; len--; }
+    while (len > 0 && isSpace(data[len - 1])) len--;
+}
+}
+
+namespace CommandTable {
+
+Parsed parse(const char* data, size_t len) {
+    Parsed parsed;
+    trim(data, len);
+    if (len == 0) {
+        parsed.id = CommandId::NONE;
+        return parsed;
+    }
+
+    const WordIndex::Word* control = WordIndex::find(ALIASES, data, len);
+    if (control != nullptr) {
+        parsed.id = (CommandId)control->value;
+        return parsed;
+    }
+
+    int animation = AnimationRegistry::find(data, len);
+    if (animation != AnimationRegistry::NOT_FOUND) {
+        parsed.id = CommandId::ANIMATION;
+        parsed.animation = (uint8_t)animation;
+        return parsed;
+    }
+
+    if (len > FILE_PREFIX_LEN && memcmp(data, FILE_PREFIX, FILE_PREFIX_LEN) == 0) {
+        data += FILE_PREFIX_LEN;
+        len -= FILE_PREFIX_LEN;
+        trim(data, len);
+        parsed.id = CommandId::PLAY_FILE;
+        parsed.arg = data;
+        parsed.argLen = len;
+        return parsed;
+    }
+
+    if (len >= TEXT_PREFIX_LEN && memcmp(data, TEXT_PREFIX, TEXT_PREFIX_LEN) == 0) {
+        data += TEXT_PREFIX_LEN;
+        len -= TEXT_PREFIX_LEN;
+        trim(data, len);
+    }
+    parsed.arg = data;
+    parsed.argLen = len;
+    return parsed;
+}
+
+size_t aliasCount() {
+    return ALIASES.size();
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+#include "WordIndex.h"
+
+/**
+ * CommandTable - maps an MQTT payload or Serial line to a typed command with
+ * one lookup and no allocation.
+ *
+ * Control words ("stop", "STATS", "ota", ...) live in a table that is sorted
+ * by (length, bytes) at compile time, so parse() is a trim plus a binary
+ * search that usually rejects on length alone. Animation names and aliases
+ * ("ANIM:VAL1", "heartbeat", ...) belong to AnimationRegistry, which indexes
+ * them the same way. "FILE:<name>" plays an animation file. Anything else is
+ * message text; "TEXT:" forces that and strips the prefix. The argument is
+ * returned as a view into the caller's buffer.
+ */
+enum class CommandId : uint8_t {
+    NONE,               // blank input
+    TEXT,               // show arg as the message
+    ANIMATION,          // start AnimationRegistry entry `animation`
+    STOP,
+    STATS,
+    OTA_CHECK,
+    PLAY_FILE           // stream /anims/<arg>.anim from the filesystem
+};
+
+namespace CommandTable {
+    struct Parsed {
+        CommandId id = CommandId::TEXT;
+        const char* arg = nullptr;   // into the parsed buffer, not terminated
+        size_t argLen = 0;
+        uint8_t animation = 0;
+    };
+
+    // Control words; value is the CommandId. AnimationRegistry checks its
+    // words against these at compile time.
+    inline constexpr WordIndex::Word CONTROL_WORDS[] = {
+        WordIndex::word("stop", (uint8_t)CommandId::STOP),
+        WordIndex::word("animation/stop", (uint8_t)CommandId::STOP),
+        WordIndex::word("ANIM:STOP", (uint8_t)CommandId::STOP),
+
+        WordIndex::word("STATS", (uint8_t)CommandId::STATS),
+        WordIndex::word("stats", (uint8_t)CommandId::STATS),
+
+        WordIndex::word("OTA:CHECK", (uint8_t)CommandId::OTA_CHECK),
+        WordIndex::word("ota", (uint8_t)CommandId::OTA_CHECK),
+        WordIndex::word("update", (uint8_t)CommandId::OTA_CHECK),
+    };
+
+    Parsed parse(const char* data, size_t len);
+
+    // Number of control words in the table (for the bench)
+    size_t aliasCount();
+}
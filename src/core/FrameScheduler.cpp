@@ -0,0 +1,116 @@
+#include "FrameScheduler.h"
+
+#ifdef SIMULATION
+#include <chrono>
+#include <thread>
+#endif
+
+namespace {
+// Signed distance from b to a on the wrapping 32-bit microsecond clock
+inline int32_t usSince(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b);
+}
+}
+
+FrameScheduler::FrameScheduler(uint16_t fps, uint16_t updateHz) {
+    setRate(fps, updateHz);
+}
+
+void FrameScheduler::setRate(uint16_t fps, uint16_t updateHz) {
+    if (fps == 0) fps = 1;
+    _fps = fps;
+    _periodUs = 1000000UL / fps;
+    _stepUs = updateHz ? 1000000UL / updateHz : _periodUs;
+    _started = false;
+    _accumulatorUs = 0;
+    resetStats();
+}
+
+uint8_t FrameScheduler::waitForFrame() {
+    uint32_t now = micros();
+    if (!_started) {
+        // First frame runs immediately with one update step
+        _started = true;
+        _deadlineUs = now + _periodUs;
+        _lastFrameUs = now;
+        _windowStartUs = now;
+        // Half a step of slack so wake-up jitter never rounds a frame down to zero updates
+        _accumulatorUs = _stepUs / 2;
+        return 1;
+    }
+
+    if (usSince(_deadlineUs, now) > 0) {
+        sleepUntil(_deadlineUs);
+        now = micros();
+    }
+
+    int32_t lateness = usSince(now, _deadlineUs);
+    uint32_t jitter = lateness < 0 ? -lateness : lateness;
+    _jitterSumUs += jitter;
+    if (jitter > _jitterMaxUs) _jitterMaxUs = jitter;
+
+    if (lateness > (int32_t)_periodUs) {
+        // Hopelessly behind: start a fresh schedule rather than racing to catch up
+        _lateFrames++;
+        _deadlineUs = now + _periodUs;
+    } else {
+        _deadlineUs += _periodUs;
+    }
+
+    _accumulatorUs += now - _lastFrameUs;
+    _lastFrameUs = now;
+    uint32_t due = _accumulatorUs / _stepUs;
+    _accumulatorUs -= due * _stepUs;
+    if (due > MAX_CATCH_UP_STEPS) {
+        _droppedSteps += due - MAX_CATCH_UP_STEPS;
+        due = MAX_CATCH_UP_STEPS;
+    }
+
+    _frames++;
+    return (uint8_t)due;
+}
+
+FrameScheduler::Stats FrameScheduler::stats() const {
+    Stats s;
+    s.frames = _frames;
+    s.lateFrames = _lateFrames;
+    s.droppedSteps = _droppedSteps;
+    s.jitterMaxUs = _jitterMaxUs;
+    if (_frames > 0) {
+        s.jitterAvgUs = (uint32_t)(_jitterSumUs / _frames);
+        uint32_t elapsed = _lastFrameUs - _windowStartUs;
+        if (elapsed > 0) s.fps = _frames * 1000000.0f / elapsed;
+    }
+    return s;
+}
+
+void FrameScheduler::resetStats() {
+    _frames = 0;
+    _windowStartUs = _lastFrameUs;
+    _jitterSumUs = 0;
+    _jitterMaxUs = 0;
+    _lateFrames = 0;
+    _droppedSteps = 0;
+}
+
+void FrameScheduler::sleepUntil(uint32_t deadlineUs) {
+#ifdef SIMULATION
+    int32_t remaining = usSince(deadlineUs, micros());
+    if (remaining > 0 && SimClock::isVirtual()) {
+        // Virtual time: land exactly on the deadline without waiting
+        SimClock::advanceUs(remaining);
+    } else if (remaining > 0) {
+        std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::microseconds(remaining));
+    }
+#else
+    // Below this much time left, spin instead of handing the CPU back to FreeRTOS
+    constexpr int32_t SPIN_US = 1500;
+    int32_t remaining = usSince(deadlineUs, micros());
+    if (remaining > SPIN_US) {
+        // Whole RTOS ticks, leaving the last stretch to the spin below
+        delay((remaining - SPIN_US) / 1000);
+    }
+    while (usSince(deadlineUs, micros()) > 0) {
+    }
+#endif
+}
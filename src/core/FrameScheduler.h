@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * FrameScheduler - paces the main loop at a target frame rate with a fixed
+ * update timestep.
+ *
+ * waitForFrame() sleeps until the next frame deadline and returns how many
+ * fixed-length update steps are due: normally one per frame when the update
+ * rate matches the frame rate, more after a slow frame (capped, so a stall
+ * never turns into a burst of catch-up work). Deadlines advance by exactly
+ * one period so timing errors do not accumulate; a frame that misses its
+ * deadline by more than a period re-anchors the schedule instead.
+ *
+ * The step count only matters to animations whose update() advances state
+ * by a fixed step: BakedAnimation and StreamedAnimation advance one frame
+ * per step. The procedural animations derive everything from millis() in
+ * update()/render(), so for them extra steps are idempotent and
+ * MAX_CATCH_UP_STEPS has no visible effect.
+ *
+ * Sleeping yields to the RTOS for whole milliseconds and spins on micros()
+ * for the last stretch, so wake-ups land within a few microseconds of the
+ * deadline while the CPU stays idle between frames. The simulator build
+ * sleeps on the host's steady clock, or, when SimClock is virtual, jumps the
+ * clock straight to the deadline.
+ */
+class FrameScheduler {
+public:
+    static constexpr uint8_t MAX_CATCH_UP_STEPS = 4;
+
+    struct Stats {
+        uint32_t frames = 0;         // paced frames; the one that starts a schedule is not counted
+        float fps = 0.0f;            // achieved, over the stats window
+        uint32_t jitterAvgUs = 0;    // mean |wake-up - deadline|
+        uint32_t jitterMaxUs = 0;
+        uint32_t lateFrames = 0;     // started more than one period late
+        uint32_t droppedSteps = 0;   // update steps skipped by the catch-up cap
+    };
+
+    // updateHz of 0 runs one update step per frame
+    explicit FrameScheduler(uint16_t fps = 30, uint16_t updateHz = 0);
+
+    // Change rates and restart the schedule (and statistics) from the next frame
+    void setRate(uint16_t fps, uint16_t updateHz = 0);
+    uint16_t targetFps() const { return _fps; }
+    uint32_t framePeriodUs() const { return _periodUs; }
+    uint32_t updateStepUs() const { return _stepUs; }
+
+    uint8_t waitForFrame();
+
+    // Statistics since the last resetStats()
+    Stats stats() const;
+    void resetStats();
+
+private:
+    uint16_t _fps = 0;
+    uint32_t _periodUs = 0;
+    uint32_t _stepUs = 0;
+    uint32_t _deadlineUs = 0;
+    uint32_t _accumulatorUs = 0;
+    uint32_t _lastFrameUs = 0;
+    bool _started = false;
+
+    uint32_t _windowStartUs = 0;
+    uint32_t _frames = 0;
+    uint64_t _jitterSumUs = 0;
+    uint32_t _jitterMaxUs = 0;
+    uint32_t _lateFrames = 0;
+    uint32_t _droppedSteps = 0;
+
+    static void sleepUntil(uint32_t deadlineUs);
+};
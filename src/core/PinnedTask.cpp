@@ -0,0 +1,44 @@
+#include "PinnedTask.h"
+
+#ifndef SIMULATION
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+PinnedTask::~PinnedTask() {
+    join();
+}
+
+bool PinnedTask::start(const char* name, Entry entry, void* arg, uint8_t core,
+                       uint32_t stackBytes, uint8_t priority) {
+    if (_started || entry == nullptr) return false;
+    _core = core;
+
+#ifdef SIMULATION
+    (void)name;
+    (void)stackBytes;
+    (void)priority;
+    _thread = std::thread(entry, arg);
+    _started = true;
+#else
+    // ESP-IDF stack depth is in bytes, not words
+    TaskHandle_t handle = nullptr;
+    _started = xTaskCreatePinnedToCore(entry, name, stackBytes, arg, priority, &handle, core) == pdPASS;
+    _handle = handle;
+#endif
+    return _started;
+}
+
+void PinnedTask::join() {
+#ifdef SIMULATION
+    if (_thread.joinable()) _thread.join();
+#endif
+}
+
+uint8_t PinnedTask::currentCore() {
+#ifdef SIMULATION
+    return 0;
+#else
+    return (uint8_t)xPortGetCoreID();
+#endif
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Arduino.h>
+
+#ifdef SIMULATION
+#include <thread>
+#endif
+
+/**
+ * PinnedTask - a long-running task bound to one CPU core.
+ *
+ * On the ESP32-S3 this is a FreeRTOS task created with
+ * xTaskCreatePinnedToCore; in the simulator it is a std::thread (the core
+ * number is recorded but not enforced), so code that splits work across
+ * tasks runs unchanged on the host.
+ *
+ * The entry function owns its loop. Firmware tasks never return; host
+ * threads may, and join() waits for that.
+ */
+class PinnedTask {
+public:
+    using Entry = void (*)(void* arg);
+
+    PinnedTask() = default;
+    ~PinnedTask();
+
+    PinnedTask(const PinnedTask&) = delete;
+    PinnedTask& operator=(const PinnedTask&) = delete;
+
+    bool start(const char* name, Entry entry, void* arg, uint8_t core,
+               uint32_t stackBytes = 8192, uint8_t priority = 1);
+    bool isStarted() const { return _started; }
+    uint8_t core() const { return _core; }
+
+    // Host only: wait for the entry function to return. No-op on the ESP32.
+    void join();
+
+    // Core the caller is running on (always 0 in the simulator)
+    static uint8_t currentCore();
+
+private:
+    bool _started = false;
+    uint8_t _core = 0;
+#ifdef SIMULATION
+    std::thread _thread;
+#else
+    void* _handle = nullptr;
+#endif
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+
+/**
+ * SpscQueue - bounded lock-free queue for exactly one producer thread/task
+ * and one consumer thread/task.
+ *
+ * The producer only writes _head and the consumer only writes _tail; each
+ * publishes its index with a release store after touching the slot, and the
+ * other side reads it with an acquire load, so no locks or critical sections
+ * are needed across the ESP32-S3's two cores (or two std::threads on the
+ * host). Elements are copied in and out by value; keep them small and
+ * trivially copyable.
+ *
+ * CAPACITY must be a power of two. One slot stays empty to tell full from
+ * empty, so CAPACITY - 1 elements fit.
+ */
+template <typename T, size_t CAPACITY>
+class SpscQueue {
+public:
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "capacity must be a power of two");
+
+    // Producer side. False (and nothing queued) when the queue is full.
+    bool push(const T& item) {
+        size_t head = _head.load(std::memory_order_relaxed);
+        size_t next = (head + 1) & MASK;
+        if (next == _tail.load(std::memory_order_acquire)) return false;
+        _items[head] = item;
+        _head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. False when there is nothing to take.
+    bool pop(T& out) {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) return false;
+        out = _items[tail];
+        _tail.store((tail + 1) & MASK, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate when called from a third thread; exact from either end
+    size_t size() const {
+        return (_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire)) & MASK;
+    }
+    bool empty() const { return size() == 0; }
+    static constexpr size_t capacity() { return CAPACITY - 1; }
+
+private:
+    static constexpr size_t MASK = CAPACITY - 1;
+
+    T _items[CAPACITY];
+    std::atomic<size_t> _head{0};   // next slot the producer writes
+    std::atomic<size_t> _tail{0};   // next slot the consumer reads
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * WordIndex - word tables sorted at compile time for command lookup.
+ *
+ * Words are ordered by (length, bytes), so a binary search usually rejects
+ * on length alone. Tables are sorted by the compiler, and
+ * strictlyIncreasing() lets a static_assert reject duplicates, within one
+ * table or, through merged(), across several.
+ */
+namespace WordIndex {
+    struct Word {
+        const char* text = "";
+        uint8_t len = 0;
+        uint8_t value = 0;    // whatever the table maps to: an id, an entry index
+    };
+
+    template <size_t N>
+    struct Table {
+        Word words[N];
+        static constexpr size_t size() { return N; }
+    };
+
+    constexpr size_t length(const char* s) {
+        size_t n = 0;
+        while (s[n] != '\0') n++;
+        return n;
+    }
+
+    constexpr Word word(const char* text, uint8_t value) {
+        Word w;
+        w.text = text;
+        w.len = (uint8_t)length(text);
+        w.value = value;
+        return w;
+    }
+
+    // Shorter words first, then bytewise
+    constexpr int compare(const char* a, size_t aLen, const char* b, size_t bLen) {
+        if (aLen != bLen) return aLen < bLen ? -1 : 1;
+        for (size_t i = 0; i < aLen; i++) {
+            if (a[i] != b[i]) return (unsigned char)a[i] < (unsigned char)b[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    template <size_t N>
+    constexpr Table<N> sorted(const Table<N>& in) {
+        Table<N> out{};
+        for (size_t i = 0; i < N; i++) {
+            Word w = in.words[i];
+            size_t j = i;
+            while (j > 0 && compare(w.text, w.len, out.words[j - 1].text, out.words[j - 1].len) < 0) {
+                out.words[j] = out.words[j - 1];
+                j--;
+            }
+            out.words[j] = w;
+        }
+        return out;
+    }
+
+    template <size_t N>
+    constexpr Table<N> sorted(const Word (&in)[N]) {
+        Table<N> table{};
+        for (size_t i = 0; i < N; i++) table.words[i] = in[i];
+        return sorted(table);
+    }
+
+    // Both tables in one sorted table, to check words are unique across them
+    template <size_t N, size_t M>
+    constexpr Table<N + M> merged(const Table<N>& a, const Table<M>& b) {
+        Table<N + M> table{};
+        for (size_t i = 0; i < N; i++) table.words[i] = a.words[i];
+        for (size_t i = 0; i < M; i++) table.words[N + i] = b.words[i];
+        return sorted(table);
+    }
+
+    // True when a sorted table has no duplicates
+    template <size_t N>
+    constexpr bool strictlyIncreasing(const Table<N>& table) {
+        for (size_t i = 1; i < N; i++) {
+            const Word& prev = table.words[i - 1];
+            const Word& cur = table.words[i];
+            if (compare(prev.text, prev.len, cur.text, cur.len) >= 0) return false;
+        }
+        return true;
+    }
+
+    // The matching word in a sorted table, or nullptr
+    template <size_t N>
+    const Word* find(const Table<N>& table, const char* text, size_t len) {
+        size_t lo = 0;
+        size_t hi = N;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            const Word& w = table.words[mid];
+            int c = compare(w.text, w.len, text, len);
+            if (c == 0) return &w;
+            if (c < 0) lo = mid + 1;
+            else hi = mid;
+        }
+        return nullptr;
+    }
+}
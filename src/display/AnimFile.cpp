@@ -0,0 +1,393 @@
+#include "AnimFile.h"
+
+#include <new>
+#include <string.h>
+#include <unordered_map>
+
+namespace {
+const uint8_t MAGIC[4] = {'A', 'N', 'I', 'M'};
+
+constexpr uint8_t LITERAL_MAX = 0x7F;   // literal of c + 1 bytes
+constexpr uint8_t REPEAT_BASE = 0x7E;   // 0x80..0xFE: repeat of c - 0x7E bytes
+constexpr uint8_t ZERO_RUN = 0xFF;      // zero run, 16-bit count follows
+constexpr size_t REPEAT_MAX = 0xFE - REPEAT_BASE;
+constexpr size_t ZERO_RUN_MIN = REPEAT_MAX + 1;
+constexpr int16_t SCRATCH_PIXELS = 64;
+
+void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+void put32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+size_t runLength(const uint8_t* bytes, size_t from, size_t count, size_t limit) {
+    size_t n = 1;
+    while (from + n < count && n < limit && bytes[from + n] == bytes[from]) n++;
+    return n;
+}
+
+// Changed pixels arrive in raster order; consecutive ones on a row become one span
+struct DisplaySink {
+    IDisplay* display;
+    const uint16_t* palette;
+    const uint8_t* indices;
+    int16_t width;
+
+    void span(size_t pos, int16_t n) {
+        uint16_t scratch[SCRATCH_PIXELS];
+        int16_t x = (int16_t)(pos % width);
+        int16_t y = (int16_t)(pos / width);
+        while (n > 0) {
+            int16_t count = n < SCRATCH_PIXELS ? n : SCRATCH_PIXELS;
+            for (int16_t i = 0; i < count; i++) scratch[i] = palette[indices[pos + i]];
+            display->drawSpan(x, y, scratch, count);
+            x += count;
+            pos += count;
+            n -= count;
+        }
+    }
+};
+
+struct BufferSink {
+    uint16_t* frame;
+    const uint16_t* palette;
+    const uint8_t* indices;
+
+    void span(size_t pos, int16_t n) {
+        for (int16_t i = 0; i < n; i++) frame[pos + i] = palette[indices[pos + i]];
+    }
+};
+
+struct NullSink {
+    void span(size_t, int16_t) {}
+};
+}
+
+namespace AnimFile {
+
+void writeHeader(const Header& header, uint8_t out[HEADER_SIZE]) {
+    memset(out, 0, HEADER_SIZE);
+    memcpy(out, MAGIC, 4);
+    out[4] = VERSION;
+    put16(out + 6, header.width);
+    put16(out + 8, header.height);
+    put16(out + 10, header.fps);
+    put16(out + 12, header.frameCount);
+    put16(out + 14, header.paletteSize);
+    put16(out + 16, header.keyframeInterval);
+    put32(out + 20, header.indexOffset);
+}
+
+bool parseHeader(const uint8_t in[HEADER_SIZE], Header& header) {
+    if (memcmp(in, MAGIC, 4) != 0 || in[4] != VERSION) return false;
+    header.width = get16(in + 6);
+    header.height = get16(in + 8);
+    header.fps = get16(in + 10);
+    header.frameCount = get16(in + 12);
+    header.paletteSize = get16(in + 14);
+    header.keyframeInterval = get16(in + 16);
+    header.indexOffset = get32(in + 20);
+    return header.width > 0 && header.height > 0 && header.fps > 0 && header.frameCount > 0 &&
+           header.paletteSize > 0 && header.paletteSize <= MAX_PALETTE;
+}
+
+void packRle(const uint8_t* bytes, size_t count, std::vector<uint8_t>& out) {
+    size_t pos = 0;
+    while (pos < count) {
+        if (bytes[pos] == 0) {
+            size_t zeros = runLength(bytes, pos, count, 0xFFFF);
+            if (zeros >= ZERO_RUN_MIN) {
+                out.push_back(ZERO_RUN);
+                out.push_back((uint8_t)zeros);
+                out.push_back((uint8_t)(zeros >> 8));
+                pos += zeros;
+                continue;
+            }
+        }
+
+        size_t repeat = runLength(bytes, pos, count, REPEAT_MAX);
+        if (repeat >= 2) {
+            out.push_back((uint8_t)(REPEAT_BASE + repeat));
+            out.push_back(bytes[pos]);
+            pos += repeat;
+            continue;
+        }
+
+        size_t end = pos + 1;
+        while (end < count && end - pos < LITERAL_MAX + 1u && runLength(bytes, end, count, 2) < 2) end++;
+        out.push_back((uint8_t)(end - pos - 1));
+        out.insert(out.end(), bytes + pos, bytes + end);
+        pos = end;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Writer
+// ----------------------------------------------------------------------------
+
+Writer::Writer(uint16_t width, uint16_t height, uint16_t fps, uint16_t keyframeInterval) {
+    _header.width = width;
+    _header.height = height;
+    _header.fps = fps;
+    _header.keyframeInterval = keyframeInterval;
+    _previous.assign((size_t)width * height, 0);
+}
+
+int Writer::paletteIndex(uint16_t color) {
+    for (size_t i = 0; i < _palette.size(); i++) {
+        if (_palette[i] == color) return (int)i;
+    }
+    if (_palette.size() >= MAX_PALETTE) return -1;
+    _palette.push_back(color);
+    return (int)_palette.size() - 1;
+}
+
+bool Writer::addFrame(const uint16_t* rgb565) {
+    const size_t total = _previous.size();
+    std::vector<uint8_t> indices(total);
+    std::unordered_map<uint16_t, uint8_t> seen;
+    for (size_t i = 0; i < total; i++) {
+        auto it = seen.find(rgb565[i]);
+        if (it == seen.end()) {
+            int index = paletteIndex(rgb565[i]);
+            if (index < 0) return false;
+            it = seen.emplace(rgb565[i], (uint8_t)index).first;
+        }
+        indices[i] = it->second;
+    }
+
+    _index.push_back((uint32_t)_frames.size());
+    if (isKeyframe(_header, _header.frameCount)) {
+        packRle(indices.data(), total, _frames);
+    } else {
+        std::vector<uint8_t> delta(total);
+        for (size_t i = 0; i < total; i++) delta[i] = indices[i] ^ _previous[i];
+        packRle(delta.data(), total, _frames);
+    }
+    _previous.swap(indices);
+    _header.frameCount++;
+    return true;
+}
+
+std::vector<uint8_t> Writer::finish() {
+    _header.paletteSize = (uint16_t)(_palette.empty() ? 1 : _palette.size());
+    if (_palette.empty()) _palette.push_back(0);
+    uint32_t base = framesOffset(_header);
+    _header.indexOffset = base + (uint32_t)_frames.size();
+
+    std::vector<uint8_t> file(HEADER_SIZE);
+    writeHeader(_header, file.data());
+    for (uint16_t color : _palette) {
+        file.push_back((uint8_t)color);
+        file.push_back((uint8_t)(color >> 8));
+    }
+    file.insert(file.end(), _frames.begin(), _frames.end());
+
+    _index.push_back((uint32_t)_frames.size());
+    for (uint32_t offset : _index) {
+        uint8_t entry[4];
+        put32(entry, base + offset);
+        file.insert(file.end(), entry, entry + 4);
+    }
+    return file;
+}
+
+// ----------------------------------------------------------------------------
+// Reader
+// ----------------------------------------------------------------------------
+
+bool Reader::open(Source* source) {
+    close();
+    _source = source;
+    uint8_t raw[HEADER_SIZE];
+    if (_source == nullptr || !_source->seek(0) || _source->read(raw, HEADER_SIZE) != HEADER_SIZE ||
+        !parseHeader(raw, _header)) {
+        _source = nullptr;
+        return false;
+    }
+
+    uint8_t color[2];
+    for (uint16_t i = 0; i < _header.paletteSize; i++) {
+        if (_source->read(color, 2) != 2) {
+            _source = nullptr;
+            return false;
+        }
+        _palette[i] = get16(color);
+    }
+
+    _indices = new (std::nothrow) uint8_t[(size_t)_header.width * _header.height]();
+    if (_indices == nullptr || !seekBytes(framesOffset(_header))) {
+        close();
+        return false;
+    }
+    _next = 0;
+    _redrawAll = false;
+    return true;
+}
+
+void Reader::close() {
+    delete[] _indices;
+    _indices = nullptr;
+    _source = nullptr;
+}
+
+bool Reader::seekBytes(uint32_t offset) {
+    _ringHead = 0;
+    _ringCount = 0;
+    _sourceEnded = false;
+    return _source->seek(offset);
+}
+
+// Top up the free part of the ring (up to two contiguous pieces)
+void Reader::refill() {
+    if (_ringCount == 0) _ringHead = 0;
+    while (!_sourceEnded && _ringCount < RING_SIZE) {
+        size_t tail = (_ringHead + _ringCount) % RING_SIZE;
+        size_t space = tail >= _ringHead ? RING_SIZE - tail : _ringHead - tail;
+        size_t n = _source->read(_ring + tail, space);
+        if (n == 0) _sourceEnded = true;
+        _ringCount += n;
+    }
+}
+
+bool Reader::readByte(uint8_t& b) {
+    // Read ahead in chunks of at least 3/4 of the ring, not byte by byte
+    if (_ringCount < RING_SIZE / 4) {
+        refill();
+        if (_ringCount == 0) return false;
+    }
+    b = _ring[_ringHead];
+    _ringHead = (_ringHead + 1) % RING_SIZE;
+    _ringCount--;
+    return true;
+}
+
+template <typename Sink>
+bool Reader::decodeFrame(Sink& sink) {
+    const size_t total = (size_t)_header.width * _header.height;
+    const bool key = isKeyframe(_header, _next);
+    size_t pos = 0;
+    size_t spanStart = 0;
+    bool inSpan = false;
+
+    auto flush = [&]() {
+        if (inSpan) sink.span(spanStart, (int16_t)(pos - spanStart));
+        inSpan = false;
+    };
+    // One decoded byte: a palette index (keyframe) or an XOR mask (delta)
+    auto apply = [&](uint8_t b) {
+        if (pos % _header.width == 0) flush();
+        if (key || b != 0) {
+            _indices[pos] = key ? b : (uint8_t)(_indices[pos] ^ b);
+            if (!inSpan) {
+                spanStart = pos;
+                inSpan = true;
+            }
+        } else {
+            flush();
+        }
+        pos++;
+    };
+
+    while (pos < total) {
+        uint8_t c;
+        if (!readByte(c)) return false;
+        if (c <= LITERAL_MAX) {
+            size_t n = c + 1u;
+            if (pos + n > total) return false;
+            for (size_t i = 0; i < n; i++) {
+                uint8_t b;
+                if (!readByte(b)) return false;
+                apply(b);
+            }
+        } else {
+            size_t n;
+            uint8_t b = 0;
+            if (c == ZERO_RUN) {
+                uint8_t lo, hi;
+                if (!readByte(lo) || !readByte(hi)) return false;
+                n = lo | (hi << 8);
+            } else {
+                n = c - REPEAT_BASE;
+                if (!readByte(b)) return false;
+            }
+            if (pos + n > total) return false;
+            if (b == 0 && !key) {
+                // Unchanged pixels: nothing to update or draw
+                flush();
+                pos += n;
+            } else {
+                for (size_t i = 0; i < n; i++) apply(b);
+            }
+        }
+    }
+    flush();
+    return true;
+}
+
+template <typename Sink>
+bool Reader::playFrame(Sink& sink) {
+    if (!isOpen()) return false;
+
+    bool ok;
+    if (_redrawAll) {
+        // Pixels changed by the frames seek() skipped were never drawn
+        NullSink none;
+        ok = decodeFrame(none);
+        const size_t width = _header.width;
+        for (size_t y = 0; ok && y < _header.height; y++) sink.span(y * width, (int16_t)width);
+        _redrawAll = false;
+    } else {
+        ok = decodeFrame(sink);
+    }
+    if (!ok) return false;
+
+    _next++;
+    if (_next >= _header.frameCount) {
+        // Frame 0 is a keyframe, so the loop restarts without the index
+        _next = 0;
+        return seekBytes(framesOffset(_header));
+    }
+    return true;
+}
+
+bool Reader::nextFrame(IDisplay* display) {
+    DisplaySink sink{display, _palette, _indices, (int16_t)_header.width};
+    return playFrame(sink);
+}
+
+bool Reader::nextFrame(uint16_t* rgb565) {
+    BufferSink sink{rgb565, _palette, _indices};
+    return playFrame(sink);
+}
+
+bool Reader::seek(uint16_t frame) {
+    if (!isOpen() || frame >= _header.frameCount) return false;
+
+    uint16_t key = _header.keyframeInterval == 0 ? 0 : frame - frame % _header.keyframeInterval;
+    uint8_t entry[4];
+    if (!_source->seek(_header.indexOffset + 4u * key) || _source->read(entry, 4) != 4) return false;
+    if (!seekBytes(get32(entry))) return false;
+
+    _next = key;
+    NullSink none;
+    while (_next < frame) {
+        if (!decodeFrame(none)) return false;
+        _next++;
+    }
+    _redrawAll = true;
+    return true;
+}
+
+}
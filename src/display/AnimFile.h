@@ -0,0 +1,125 @@
+#pragma once
+
+#include "IDisplay.h"
+#include <vector>
+
+/**
+ * AnimFile - the .anim container for animations stored on the flash
+ * filesystem instead of compiled into the firmware.
+ *
+ * Layout (all integers little-endian):
+ *
+ *   header    24 bytes: "ANIM", version, flags, width, height, fps,
+ *             frameCount, paletteSize, keyframeInterval, indexOffset
+ *   palette   paletteSize RGB565 colors; pixels are 8-bit palette indices
+ *   frames    every keyframeInterval-th frame (and frame 0) is a keyframe:
+ *             RLE of the indices; the rest are deltas: RLE of (indices XOR
+ *             previous indices). Frames are self-delimiting (width * height
+ *             pixels), so playback reads them back to back.
+ *   index     frameCount + 1 file offsets (the last is the end of the
+ *             frames), read only to seek() to the nearest keyframe
+ *
+ * RLE control byte: 0x00-0x7F literal of c+1 bytes, 0x80-0xFE repeat of the
+ * next byte c-0x7E times, 0xFF a zero run with a 16-bit count (unchanged
+ * pixels in a delta).
+ *
+ * Writer builds a whole file in memory (host, bake tool). Reader streams
+ * one: bytes come from a Source through a 256-byte ring buffer, so RAM is
+ * the previous frame's indices (width * height bytes), the palette and the
+ * ring, whatever the file size. Both share the RLE coding below.
+ */
+namespace AnimFile {
+    constexpr uint8_t VERSION = 1;
+    constexpr size_t HEADER_SIZE = 24;
+    constexpr uint16_t MAX_PALETTE = 256;
+
+    struct Header {
+        uint16_t width = 0;
+        uint16_t height = 0;
+        uint16_t fps = 0;
+        uint16_t frameCount = 0;
+        uint16_t paletteSize = 0;
+        uint16_t keyframeInterval = 0;
+        uint32_t indexOffset = 0;
+    };
+
+    void writeHeader(const Header& header, uint8_t out[HEADER_SIZE]);
+    bool parseHeader(const uint8_t in[HEADER_SIZE], Header& header);
+
+    inline bool isKeyframe(const Header& header, uint16_t frame) {
+        return header.keyframeInterval == 0 ? frame == 0 : frame % header.keyframeInterval == 0;
+    }
+    inline uint32_t framesOffset(const Header& header) { return HEADER_SIZE + 2u * header.paletteSize; }
+
+    // Shared RLE coding of one frame's bytes
+    void packRle(const uint8_t* bytes, size_t count, std::vector<uint8_t>& out);
+
+    class Writer {
+    public:
+        Writer(uint16_t width, uint16_t height, uint16_t fps, uint16_t keyframeInterval);
+
+        // False once the animation needs more than MAX_PALETTE colors
+        bool addFrame(const uint16_t* rgb565);
+        std::vector<uint8_t> finish();
+
+    private:
+        Header _header;
+        std::vector<uint16_t> _palette;
+        std::vector<uint8_t> _previous;
+        std::vector<uint8_t> _frames;
+        std::vector<uint32_t> _index;
+
+        int paletteIndex(uint16_t color);
+    };
+
+    class Reader {
+    public:
+        static constexpr size_t RING_SIZE = 256;
+
+        class Source {
+        public:
+            virtual ~Source() = default;
+            virtual bool seek(uint32_t offset) = 0;
+            // Bytes copied into buf, 0 at end of file
+            virtual size_t read(uint8_t* buf, size_t maxLen) = 0;
+        };
+
+        ~Reader() { close(); }
+
+        bool open(Source* source);
+        void close();
+        bool isOpen() const { return _indices != nullptr; }
+        const Header& header() const { return _header; }
+
+        // Next frame (wrapping to frame 0): updates the indices and draws the
+        // pixels that changed, or every pixel for a keyframe
+        bool nextFrame(IDisplay* display);
+        bool nextFrame(uint16_t* rgb565);
+
+        // Position so the next nextFrame() yields `frame`
+        bool seek(uint16_t frame);
+        uint16_t position() const { return _next; }
+
+    private:
+        Source* _source = nullptr;
+        Header _header;
+        uint16_t _palette[MAX_PALETTE];
+        uint8_t* _indices = nullptr;
+        uint16_t _next = 0;
+        bool _redrawAll = false;    // after seek(): the target has not seen the skipped frames
+
+        uint8_t _ring[RING_SIZE];
+        size_t _ringHead = 0;
+        size_t _ringCount = 0;
+        bool _sourceEnded = false;
+
+        bool seekBytes(uint32_t offset);
+        void refill();
+        bool readByte(uint8_t& b);
+
+        template <typename Sink>
+        bool decodeFrame(Sink& sink);
+        template <typename Sink>
+        bool playFrame(Sink& sink);
+    };
+}
@@ -0,0 +1,213 @@
+#include "Canvas565.h"
+
+#include <string.h>
+
+Canvas565::Canvas565(int16_t width, int16_t height)
+    : _width(width), _height(height), _pixels(new uint16_t[width * height]) {
+    memset(_pixels, 0, sizeof(uint16_t) * width * height);
+}
+
+Canvas565::~Canvas565() {
+    delete[] _pixels;
+    for (uint8_t i = 0; i < MAX_TARGET_BUFFERS; i++) delete[] _shadow[i];
+}
+
+void Canvas565::setTargetBuffers(uint8_t count) {
+    if (count < 1) count = 1;
+    if (count > MAX_TARGET_BUFFERS) count = MAX_TARGET_BUFFERS;
+    for (uint8_t i = 0; i < count; i++) {
+        if (_shadow[i] == nullptr) _shadow[i] = new uint16_t[_width * _height];
+    }
+    _targetBuffers = count;
+    _backBuffer = 0;
+    invalidate();
+}
+
+void Canvas565::invalidate() {
+    for (uint8_t i = 0; i < MAX_TARGET_BUFFERS; i++) _shadowValid[i] = false;
+}
+
+uint16_t Canvas565::getPixel(int16_t x, int16_t y) const {
+    if (x < 0 || x >= _width || y < 0 || y >= _height) return 0;
+    return _pixels[y * _width + x];
+}
+
+void Canvas565::present(IDisplay* target) {
+    if (target == nullptr) return;
+    _lastStats = PresentStats();
+    _presentCount++;
+
+    if (_shadow[_backBuffer] == nullptr) _shadow[_backBuffer] = new uint16_t[_width * _height];
+    uint16_t* shadow = _shadow[_backBuffer];
+    if (!_shadowValid[_backBuffer]) {
+        // Buffer contents unknown: send everything once
+        target->drawBitmap565(0, 0, _pixels, _width, _height);
+        memcpy(shadow, _pixels, sizeof(uint16_t) * _width * _height);
+        _shadowValid[_backBuffer] = true;
+        _rects.reset();
+        _lastStats.rectCount = 1;
+        _lastStats.pixelsChanged = (uint32_t)_width * _height;
+        _lastStats.pixelsSent = _lastStats.pixelsChanged;
+    } else {
+        collectDirtyRects(shadow);
+
+        for (uint8_t i = 0; i < _rects.count(); i++) {
+            const DirtyRect& r = _rects.rect(i);
+            for (int16_t y = r.y; y < r.y + r.h; y++) {
+                const uint16_t* src = &_pixels[y * _width + r.x];
+                target->drawSpan(r.x, y, src, r.w);
+                memcpy(&shadow[y * _width + r.x], src, sizeof(uint16_t) * r.w);
+            }
+        }
+
+        _lastStats.rectCount = _rects.count();
+        _lastStats.pixelsSent = _rects.area();
+    }
+
+    _totalPixelsSent += _lastStats.pixelsSent;
+    _backBuffer = (_backBuffer + 1) % _targetBuffers;
+    _dirty = false;
+}
+
+void Canvas565::collectDirtyRects(const uint16_t* shadow) {
+    _rects.reset();
+    for (int16_t y = 0; y < _height; y++) {
+        const uint16_t* cur = &_pixels[y * _width];
+        const uint16_t* old = &shadow[y * _width];
+        if (memcmp(cur, old, sizeof(uint16_t) * _width) == 0) continue;
+
+        // One span per row from the first to the last changed column
+        int16_t first = 0;
+        while (cur[first] == old[first]) first++;
+        int16_t last = _width - 1;
+        while (cur[last] == old[last]) last--;
+
+        for (int16_t x = first; x <= last; x++) {
+            if (cur[x] != old[x]) _lastStats.pixelsChanged++;
+        }
+        _rects.addRowSpan(y, first, last);
+    }
+}
+
+void Canvas565::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || x >= _width || y < 0 || y >= _height) return;
+    _pixels[y * _width + x] = color;
+    _dirty = true;
+}
+
+void Canvas565::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (y0 == y1) {
+        if (x1 < x0) { int16_t t = x0; x0 = x1; x1 = t; }
+        fillRowClipped(x0, y0, x1 - x0 + 1, color);
+        return;
+    }
+
+    int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy;
+
+    while (true) {
+        drawPixel(x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+void Canvas565::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    fillRowClipped(x, y, w, color);
+}
+
+void Canvas565::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+    fillRowClipped(x, y, w, color);
+    fillRowClipped(x, y + h - 1, w, color);
+    for (int16_t py = y + 1; py < y + h - 1; py++) {
+        drawPixel(x, py, color);
+        drawPixel(x + w - 1, py, color);
+    }
+}
+
+void Canvas565::drawSpan(int16_t x, int16_t y, const uint16_t* colors, int16_t w) {
+    if (y < 0 || y >= _height || w <= 0) return;
+    int16_t x0 = x < 0 ? 0 : x;
+    int16_t x1 = (x + w > _width) ? _width : x + w;
+    if (x1 <= x0) return;
+    memcpy(&_pixels[y * _width + x0], colors + (x0 - x), sizeof(uint16_t) * (x1 - x0));
+    _dirty = true;
+}
+
+void Canvas565::drawRow(int16_t y, const uint16_t* colors) {
+    if (y < 0 || y >= _height) return;
+    memcpy(&_pixels[y * _width], colors, sizeof(uint16_t) * _width);
+    _dirty = true;
+}
+
+void Canvas565::drawBitmap565(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
+    if (x == 0 && w == _width && h > 0 && y >= 0 && y + h <= _height) {
+        // Full-width rows are contiguous in both buffers
+        memcpy(&_pixels[y * _width], bitmap, sizeof(uint16_t) * _width * h);
+        _dirty = true;
+        return;
+    }
+    for (int16_t row = 0; row < h; row++) {
+        Canvas565::drawSpan(x, y + row, bitmap + row * w, w);
+    }
+}
+
+void Canvas565::fillScreen(uint16_t color) {
+    uint32_t count = (uint32_t)_width * _height;
+    if ((color >> 8) == (color & 0xFF)) {
+        memset(_pixels, color & 0xFF, sizeof(uint16_t) * count);
+    } else {
+        for (uint32_t i = 0; i < count; i++) _pixels[i] = color;
+    }
+    _dirty = true;
+}
+
+void Canvas565::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+    int16_t y0 = y < 0 ? 0 : y;
+    int16_t y1 = (y + h > _height) ? _height : y + h;
+    for (int16_t py = y0; py < y1; py++) fillRowClipped(x, py, w, color);
+}
+
+void Canvas565::clearScreen() {
+    fillScreen(0);
+}
+
+void Canvas565::setCursor(int16_t x, int16_t y) {
+    _cursor.x = x;
+    _cursor.y = y;
+}
+
+void Canvas565::print(const char* text) {
+    GfxText::print(this, _cursor, text);
+}
+
+void Canvas565::setTextColor(uint16_t color) {
+    _cursor.color = color;
+}
+
+void Canvas565::setTextWrap(bool wrap) {
+    _cursor.wrap = wrap;
+}
+
+void Canvas565::setTextSize(uint8_t size) {
+    _cursor.size = size > 0 ? size : 1;
+}
+
+uint16_t Canvas565::color565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+void Canvas565::fillRowClipped(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (y < 0 || y >= _height || w <= 0) return;
+    int16_t x0 = x < 0 ? 0 : x;
+    int16_t x1 = (x + w > _width) ? _width : x + w;
+    if (x1 <= x0) return;
+    uint16_t* row = &_pixels[y * _width];
+    for (int16_t px = x0; px < x1; px++) row[px] = color;
+    _dirty = true;
+}
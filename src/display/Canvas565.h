@@ -0,0 +1,92 @@
+#pragma once
+
+#include "IDisplay.h"
+#include "GfxText.h"
+#include "DirtyRects.h"
+
+/**
+ * Canvas565 - RAM-resident RGB565 framebuffer that implements IDisplay.
+ *
+ * Animations draw into the canvas at memory speed; present() then diffs the
+ * finished frame against a shadow copy of what the panel already shows and
+ * pushes only the changed rectangles, so the DMA engine never scans out a
+ * half-drawn frame and static pixels are not re-sent.
+ *
+ * A double-buffered target alternates between two back buffers, each one
+ * frame behind the other, so the canvas keeps one shadow per target buffer
+ * and diffs against the one about to be drawn into.
+ *
+ * Memory: (1 + buffers) * width * height * 2 bytes (16 KB for a 64x64 panel
+ * single-buffered, 24 KB double-buffered). Shadows are allocated by
+ * setTargetBuffers() or the first present(), so a canvas that is only drawn
+ * into and read back (e.g. a StaticLayer) costs width * height * 2 bytes.
+ */
+class Canvas565 : public IDisplay {
+public:
+    Canvas565(int16_t width = 64, int16_t height = 64);
+    ~Canvas565() override;
+
+    Canvas565(const Canvas565&) = delete;
+    Canvas565& operator=(const Canvas565&) = delete;
+
+    bool isAllocated() const { return _pixels != nullptr; }
+    uint16_t* buffer() { return _pixels; }
+    const uint16_t* buffer() const { return _pixels; }
+    uint16_t getPixel(int16_t x, int16_t y) const;
+
+    // True when anything was drawn since the last present()
+    bool isDirty() const { return _dirty; }
+    void present(IDisplay* target);
+
+    // Match the target's buffer count (1 or 2) before the first present()
+    void setTargetBuffers(uint8_t count);
+    // Forget what the panel shows; the next present() to each buffer sends the whole frame
+    void invalidate();
+    const PresentStats& lastPresentStats() const { return _lastStats; }
+    const DirtyRectTracker& lastDirtyRects() const { return _rects; }
+    uint32_t totalPixelsSent() const { return _totalPixelsSent; }
+    uint32_t presentCount() const { return _presentCount; }
+
+    int16_t width() const override { return _width; }
+    int16_t height() const override { return _height; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+    void drawSpan(int16_t x, int16_t y, const uint16_t* colors, int16_t w) override;
+    void drawRow(int16_t y, const uint16_t* colors) override;
+    void drawBitmap565(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) override;
+
+    void fillScreen(uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void clearScreen() override;
+
+    void setCursor(int16_t x, int16_t y) override;
+    void print(const char* text) override;
+    void setTextColor(uint16_t color) override;
+    void setTextWrap(bool wrap) override;
+    void setTextSize(uint8_t size) override;
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) override;
+
+private:
+    int16_t _width;
+    int16_t _height;
+    uint16_t* _pixels = nullptr;
+    static constexpr uint8_t MAX_TARGET_BUFFERS = 2;
+    uint16_t* _shadow[MAX_TARGET_BUFFERS] = {nullptr, nullptr};   // last frame sent to each target buffer
+    bool _shadowValid[MAX_TARGET_BUFFERS] = {false, false};
+    uint8_t _targetBuffers = 1;
+    uint8_t _backBuffer = 0;
+    bool _dirty = false;
+    GfxText::Cursor _cursor;
+    DirtyRectTracker _rects;
+    PresentStats _lastStats;
+    uint32_t _totalPixelsSent = 0;
+    uint32_t _presentCount = 0;
+
+    void fillRowClipped(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void collectDirtyRects(const uint16_t* shadow);
+};
@@ -0,0 +1,92 @@
+#include "ClockWidget.h"
+
+#include <string.h>
+
+namespace {
+// Tiny 4x5 pixel font for digits and colon
+const uint8_t TINY_DIGITS[11][5] = {
+    {0b1111, 0b1001, 0b1001, 0b1001, 0b1111}, // 0
+    {0b0010, 0b0110, 0b0010, 0b0010, 0b0111}, // 1
+    {0b1111, 0b0001, 0b1111, 0b1000, 0b1111}, // 2
+    {0b1111, 0b0001, 0b1111, 0b0001, 0b1111}, // 3
+    {0b1001, 0b1001, 0b1111, 0b0001, 0b0001}, // 4
+    {0b1111, 0b1000, 0b1111, 0b0001, 0b1111}, // 5
+    {0b1111, 0b1000, 0b1111, 0b1001, 0b1111}, // 6
+    {0b1111, 0b0001, 0b0001, 0b0001, 0b0001}, // 7
+    {0b1111, 0b1001, 0b1111, 0b1001, 0b1111}, // 8
+    {0b1111, 0b1001, 0b1111, 0b0001, 0b1111}, // 9
+    {0b0000, 0b0100, 0b0000, 0b0100, 0b0000}  // : (colon)
+};
+
+const uint16_t BOX_COLOR = 0x0000;
+const uint16_t TEXT_COLOR = 0xFFFF;
+
+uint8_t clampedLength(const char* text) {
+    size_t n = text != nullptr ? strlen(text) : 0;
+    return (uint8_t)(n > ClockWidget::MAX_CHARS ? ClockWidget::MAX_CHARS : n);
+}
+}
+
+int16_t ClockWidget::originX(uint8_t length) const {
+    int16_t totalWidth = length * (CHAR_W + SPACING) - SPACING;
+    return _panelWidth - totalWidth - 3;
+}
+
+void ClockWidget::drawChar(IDisplay* display, char c, int16_t x, int16_t y, uint16_t color) const {
+    int digit;
+    if (c >= '0' && c <= '9') {
+        digit = c - '0';
+    } else if (c == ':') {
+        digit = 10;
+    } else {
+        return;
+    }
+
+    for (int16_t row = 0; row < CHAR_H; row++) {
+        uint8_t rowData = TINY_DIGITS[digit][row];
+        for (int16_t col = 0; col < CHAR_W; col++) {
+            if (rowData & (1 << (3 - col))) {
+                display->drawPixel(x + col, y + row, color);
+            }
+        }
+    }
+}
+
+void ClockWidget::store(const char* text, uint8_t length) {
+    memcpy(_text, text, length);
+    _text[length] = '\0';
+    _length = length;
+}
+
+void ClockWidget::draw(IDisplay* display, const char* text) {
+    uint8_t length = clampedLength(text);
+    store(length > 0 ? text : "", length);
+    _drawn = true;
+    if (length == 0) return;
+
+    int16_t x = originX(length);
+    int16_t y = originY();
+    int16_t totalWidth = length * (CHAR_W + SPACING) - SPACING;
+
+    // Black box with 1px padding keeps the digits readable over the message
+    display->fillRect(x - 2, y - 1, totalWidth + 4, 7, BOX_COLOR);
+    for (uint8_t i = 0; i < length; i++) {
+        drawChar(display, _text[i], x + i * (CHAR_W + SPACING), y, TEXT_COLOR);
+    }
+}
+
+bool ClockWidget::update(IDisplay* display, const char* text) {
+    uint8_t length = clampedLength(text);
+    if (!_drawn || length != _length) return false;
+
+    int16_t x = originX(length);
+    int16_t y = originY();
+    for (uint8_t i = 0; i < length; i++) {
+        if (_text[i] == text[i]) continue;
+        int16_t cellX = x + i * (CHAR_W + SPACING);
+        display->fillRect(cellX, y, CHAR_W, CHAR_H, BOX_COLOR);
+        drawChar(display, text[i], cellX, y, TEXT_COLOR);
+        _text[i] = text[i];
+    }
+    return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "IDisplay.h"
+
+/**
+ * ClockWidget - the "HH:MM" timestamp in the bottom-right corner, drawn in
+ * the tiny 4x5 digit font on a black box.
+ *
+ * draw() paints the whole widget (after the screen behind it was redrawn).
+ * update() compares the new time with what is on screen and repaints only
+ * the character cells that differ, so a minute tick touches one or two
+ * 4x5 cells instead of the whole panel. It returns false when it cannot
+ * update in place (nothing drawn yet, or the box would change size); the
+ * caller then redraws the screen and calls draw().
+ */
+class ClockWidget {
+public:
+    static constexpr uint8_t MAX_CHARS = 8;
+    static constexpr int16_t CHAR_W = 4;
+    static constexpr int16_t CHAR_H = 5;
+    static constexpr int16_t SPACING = 1;
+
+    ClockWidget(int16_t panelWidth, int16_t panelHeight)
+        : _panelWidth(panelWidth), _panelHeight(panelHeight) {}
+
+    void draw(IDisplay* display, const char* text);
+    bool update(IDisplay* display, const char* text);
+
+    // Forget what is on screen, e.g. after something else drew over the box
+    void invalidate() { _length = 0; _drawn = false; }
+
+    const char* text() const { return _text; }
+
+private:
+    int16_t _panelWidth;
+    int16_t _panelHeight;
+    char _text[MAX_CHARS + 1] = {0};
+    uint8_t _length = 0;
+    bool _drawn = false;
+
+    int16_t originX(uint8_t length) const;
+    int16_t originY() const { return _panelHeight - 7; }
+    void drawChar(IDisplay* display, char c, int16_t x, int16_t y, uint16_t color) const;
+    void store(const char* text, uint8_t length);
+};
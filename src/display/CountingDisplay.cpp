@@ -0,0 +1,225 @@
+#include "CountingDisplay.h"
+
+#include <string.h>
+
+#ifdef SIMULATION
+#include <chrono>
+#endif
+
+namespace {
+const char* const PRIMITIVE_NAMES[CountingDisplay::PRIMITIVE_COUNT] = {
+    "drawPixel", "drawLine", "drawFastHLine", "drawRect", "drawSpan", "drawRow",
+    "drawBitmap565", "fillScreen", "fillRect", "clearScreen", "print",
+};
+
+// Free-running timestamp; only differences are used, so wrap-around is harmless
+inline uint32_t timestamp() {
+#ifdef SIMULATION
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    return ESP.getCycleCount();
+#endif
+}
+
+inline uint32_t elapsedNs(uint32_t started) {
+    uint32_t ticks = timestamp() - started;
+#ifdef SIMULATION
+    return ticks;
+#else
+    return (uint32_t)((uint64_t)ticks * 1000 / ESP.getCpuFreqMHz());
+#endif
+}
+}
+
+uint32_t CountingDisplay::FrameStats::totalCalls() const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < PRIMITIVE_COUNT; i++) total += calls[i];
+    return total;
+}
+
+uint32_t CountingDisplay::FrameStats::totalTimeNs() const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < PRIMITIVE_COUNT; i++) total += timeNs[i];
+    return total;
+}
+
+CountingDisplay::CountingDisplay(IDisplay& inner, bool trackOverdraw, bool timeCalls)
+    : _inner(inner), _timeCalls(timeCalls) {
+    if (trackOverdraw) {
+        size_t size = (size_t)inner.width() * inner.height();
+        _writes = new uint8_t[size];
+        memset(_writes, 0, size);
+    }
+}
+
+CountingDisplay::~CountingDisplay() {
+    delete[] _writes;
+}
+
+const char* CountingDisplay::primitiveName(Primitive primitive) {
+    return primitive < PRIMITIVE_COUNT ? PRIMITIVE_NAMES[primitive] : "?";
+}
+
+void CountingDisplay::endFrame() {
+    if (_writes != nullptr) {
+        size_t size = (size_t)width() * height();
+        for (size_t i = 0; i < size; i++) {
+            uint8_t n = _writes[i];
+            if (n == 0) continue;
+            _current.pixelsTouched++;
+            if (n > 1) _current.pixelsOverdrawn++;
+            if (n > _current.maxWrites) _current.maxWrites = n;
+        }
+        memset(_writes, 0, size);
+    }
+    _last = _current;
+    _current = FrameStats();
+    _frames++;
+}
+
+uint8_t CountingDisplay::writesAt(int16_t x, int16_t y) const {
+    if (_writes == nullptr || x < 0 || x >= width() || y < 0 || y >= height()) return 0;
+    return _writes[y * width() + x];
+}
+
+void CountingDisplay::reset() {
+    if (_writes != nullptr) memset(_writes, 0, (size_t)width() * height());
+    _current = FrameStats();
+    _last = FrameStats();
+    _frames = 0;
+}
+
+uint32_t CountingDisplay::begin(Primitive primitive) {
+    _current.calls[primitive]++;
+    return _timeCalls ? timestamp() : 0;
+}
+
+void CountingDisplay::finish(Primitive primitive, uint32_t started) {
+    if (_timeCalls) _current.timeNs[primitive] += elapsedNs(started);
+}
+
+void CountingDisplay::markPixel(int16_t x, int16_t y) {
+    if (x < 0 || x >= width() || y < 0 || y >= height()) return;
+    _current.pixelWrites++;
+    if (_writes != nullptr) {
+        uint8_t& n = _writes[y * width() + x];
+        if (n < 255) n++;
+    }
+}
+
+void CountingDisplay::markRow(int16_t x, int16_t y, int16_t w) {
+    if (y < 0 || y >= height() || w <= 0) return;
+    int16_t x0 = x < 0 ? 0 : x;
+    int16_t x1 = x + w > width() ? width() : x + w;
+    if (x1 <= x0) return;
+    _current.pixelWrites += x1 - x0;
+    if (_writes != nullptr) {
+        uint8_t* row = &_writes[y * width()];
+        for (int16_t px = x0; px < x1; px++) {
+            if (row[px] < 255) row[px]++;
+        }
+    }
+}
+
+void CountingDisplay::markRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+    for (int16_t row = 0; row < h; row++) markRow(x, y + row, w);
+}
+
+void CountingDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    uint32_t started = begin(DRAW_PIXEL);
+    _inner.drawPixel(x, y, color);
+    finish(DRAW_PIXEL, started);
+    markPixel(x, y);
+}
+
+void CountingDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    uint32_t started = begin(DRAW_LINE);
+    _inner.drawLine(x0, y0, x1, y1, color);
+    finish(DRAW_LINE, started);
+
+    // Walk the same Bresenham line the displays draw
+    int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy;
+    while (true) {
+        markPixel(x0, y0);
+        if (x0 == x1 && y0 == y1) break;
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
+
+void CountingDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    uint32_t started = begin(DRAW_FAST_HLINE);
+    _inner.drawFastHLine(x, y, w, color);
+    finish(DRAW_FAST_HLINE, started);
+    markRow(x, y, w);
+}
+
+void CountingDisplay::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    uint32_t started = begin(DRAW_RECT);
+    _inner.drawRect(x, y, w, h, color);
+    finish(DRAW_RECT, started);
+    if (w <= 0 || h <= 0) return;
+    markRow(x, y, w);
+    if (h > 1) markRow(x, y + h - 1, w);
+    for (int16_t py = y + 1; py < y + h - 1; py++) {
+        markPixel(x, py);
+        if (w > 1) markPixel(x + w - 1, py);
+    }
+}
+
+void CountingDisplay::drawSpan(int16_t x, int16_t y, const uint16_t* colors, int16_t w) {
+    uint32_t started = begin(DRAW_SPAN);
+    _inner.drawSpan(x, y, colors, w);
+    finish(DRAW_SPAN, started);
+    markRow(x, y, w);
+}
+
+void CountingDisplay::drawRow(int16_t y, const uint16_t* colors) {
+    uint32_t started = begin(DRAW_ROW);
+    _inner.drawRow(y, colors);
+    finish(DRAW_ROW, started);
+    markRow(0, y, width());
+}
+
+void CountingDisplay::drawBitmap565(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
+    uint32_t started = begin(DRAW_BITMAP);
+    _inner.drawBitmap565(x, y, bitmap, w, h);
+    finish(DRAW_BITMAP, started);
+    markRect(x, y, w, h);
+}
+
+void CountingDisplay::fillScreen(uint16_t color) {
+    uint32_t started = begin(FILL_SCREEN);
+    _inner.fillScreen(color);
+    finish(FILL_SCREEN, started);
+    markRect(0, 0, width(), height());
+}
+
+void CountingDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    uint32_t started = begin(FILL_RECT);
+    _inner.fillRect(x, y, w, h, color);
+    finish(FILL_RECT, started);
+    markRect(x, y, w, h);
+}
+
+void CountingDisplay::clearScreen() {
+    uint32_t started = begin(CLEAR_SCREEN);
+    _inner.clearScreen();
+    finish(CLEAR_SCREEN, started);
+    markRect(0, 0, width(), height());
+}
+
+void CountingDisplay::print(const char* text) {
+    uint32_t started = begin(PRINT);
+    _inner.print(text);
+    finish(PRINT, started);
+}
+
+void CountingDisplay::flip() {
+    _inner.flip();
+    endFrame();
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "IDisplay.h"
+
+/**
+ * CountingDisplay - IDisplay decorator that records what is drawn through it.
+ *
+ * Every call is forwarded to the wrapped display unchanged. Per frame the
+ * decorator counts calls per primitive, the pixel writes they cover (clipped
+ * to the panel), and, with overdraw tracking on, how many times each pixel
+ * was written: a fillScreen followed by a full redraw shows up as every
+ * pixel written twice. Call timing is optional because reading the clock
+ * costs about as much as a drawPixel; it uses the host steady clock in the
+ * simulator and the CPU cycle counter on the ESP32.
+ *
+ * A frame ends at flip() or endFrame(); its statistics then move to
+ * lastFrame() and the counters start again. print() is counted as a call
+ * only - the wrapped display rasterizes the glyphs itself.
+ *
+ * Memory: width * height bytes for the per-pixel counts (4 KB on a 64x64
+ * panel), allocated only when overdraw tracking is on.
+ */
+class CountingDisplay : public IDisplay {
+public:
+    enum Primitive : uint8_t {
+        DRAW_PIXEL,
+        DRAW_LINE,
+        DRAW_FAST_HLINE,
+        DRAW_RECT,
+        DRAW_SPAN,
+        DRAW_ROW,
+        DRAW_BITMAP,
+        FILL_SCREEN,
+        FILL_RECT,
+        CLEAR_SCREEN,
+        PRINT,
+        PRIMITIVE_COUNT
+    };
+
+    struct FrameStats {
+        uint32_t calls[PRIMITIVE_COUNT] = {};
+        uint32_t timeNs[PRIMITIVE_COUNT] = {};  // zero unless timing is on
+        uint32_t pixelWrites = 0;
+        // Filled in only with overdraw tracking
+        uint32_t pixelsTouched = 0;      // distinct pixels written at least once
+        uint32_t pixelsOverdrawn = 0;    // written more than once
+        uint8_t maxWrites = 0;           // most writes to one pixel (saturates at 255)
+
+        uint32_t totalCalls() const;
+        uint32_t totalTimeNs() const;
+        // Mean writes per touched pixel; 1.0 means nothing was drawn twice
+        float overdraw() const { return pixelsTouched ? (float)pixelWrites / pixelsTouched : 0.0f; }
+    };
+
+    explicit CountingDisplay(IDisplay& inner, bool trackOverdraw = true, bool timeCalls = false);
+    ~CountingDisplay() override;
+
+    CountingDisplay(const CountingDisplay&) = delete;
+    CountingDisplay& operator=(const CountingDisplay&) = delete;
+
+    static const char* primitiveName(Primitive primitive);
+
+    IDisplay& inner() { return _inner; }
+    void setTiming(bool enabled) { _timeCalls = enabled; }
+
+    // Close the current frame without flipping the wrapped display
+    void endFrame();
+    // The frame being drawn, and the last one closed
+    const FrameStats& currentFrame() const { return _current; }
+    const FrameStats& lastFrame() const { return _last; }
+    uint32_t frameCount() const { return _frames; }
+    // Writes to one pixel in the current frame (0 without overdraw tracking)
+    uint8_t writesAt(int16_t x, int16_t y) const;
+    // Drop the current frame's counts and the frame counter
+    void reset();
+
+    int16_t width() const override { return _inner.width(); }
+    int16_t height() const override { return _inner.height(); }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+    void drawSpan(int16_t x, int16_t y, const uint16_t* colors, int16_t w) override;
+    void drawRow(int16_t y, const uint16_t* colors) override;
+    void drawBitmap565(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) override;
+
+    void fillScreen(uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void clearScreen() override;
+
+    void setCursor(int16_t x, int16_t y) override { _inner.setCursor(x, y); }
+    void print(const char* text) override;
+    void setTextColor(uint16_t color) override { _inner.setTextColor(color); }
+    void setTextWrap(bool wrap) override { _inner.setTextWrap(wrap); }
+    void setTextSize(uint8_t size) override { _inner.setTextSize(size); }
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b) override { return _inner.color565(r, g, b); }
+
+    void flip() override;
+    uint8_t bufferCount() const override { return _inner.bufferCount(); }
+
+private:
+    IDisplay& _inner;
+    bool _timeCalls;
+    uint8_t* _writes = nullptr;   // per-pixel counts, row-major
+    FrameStats _current;
+    FrameStats _last;
+    uint32_t _frames = 0;
+
+    // Count a call; returns a timestamp for finish() when timing is on
+    uint32_t begin(Primitive primitive);
+    void finish(Primitive primitive, uint32_t started);
+
+    void markPixel(int16_t x, int16_t y);
+    void markRow(int16_t x, int16_t y, int16_t w);
+    void markRect(int16_t x, int16_t y, int16_t w, int16_t h);
+};
@@ -0,0 +1,49 @@
+#include "DirtyRects.h"
+
+void DirtyRectTracker::unionInto(DirtyRect& r, int16_t y, int16_t x0, int16_t x1) {
+    int16_t left = min<int16_t>(r.x, x0);
+    int16_t right = max<int16_t>(r.x + r.w - 1, x1);
+    int16_t top = min<int16_t>(r.y, y);
+    int16_t bottom = max<int16_t>(r.y + r.h - 1, y);
+    r.x = left;
+    r.w = right - left + 1;
+    r.y = top;
+    r.h = bottom - top + 1;
+}
+
+void DirtyRectTracker::addRowSpan(int16_t y, int16_t x0, int16_t x1) {
+    // Grow a rect that ended on the previous (or this) row and overlaps horizontally
+    for (uint8_t i = 0; i < _count; i++) {
+        DirtyRect& r = _rects[i];
+        int16_t bottom = r.y + r.h - 1;
+        if (y > bottom + 1) continue;
+        if (x0 > r.x + r.w - 1 + MERGE_GAP || x1 < r.x - MERGE_GAP) continue;
+        unionInto(r, y, x0, x1);
+        return;
+    }
+
+    if (_count < MAX_RECTS) {
+        _rects[_count++] = {x0, y, (int16_t)(x1 - x0 + 1), 1};
+        return;
+    }
+
+    // Out of slots: fold into the rect whose area grows the least
+    uint8_t best = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (uint8_t i = 0; i < _count; i++) {
+        DirtyRect grown = _rects[i];
+        unionInto(grown, y, x0, x1);
+        uint32_t growth = (uint32_t)grown.w * grown.h - (uint32_t)_rects[i].w * _rects[i].h;
+        if (growth < bestGrowth) {
+            bestGrowth = growth;
+            best = i;
+        }
+    }
+    unionInto(_rects[best], y, x0, x1);
+}
+
+uint32_t DirtyRectTracker::area() const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < _count; i++) total += (uint32_t)_rects[i].w * _rects[i].h;
+    return total;
+}
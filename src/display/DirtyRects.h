@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * DirtyRects - coalesces changed row spans into a short list of rectangles.
+ *
+ * Rows are fed top to bottom; a span that touches the previous row's rect
+ * grows it, otherwise a new rect opens. When the list is full the span is
+ * folded into whichever rect grows the least, so the cost stays bounded.
+ */
+
+struct DirtyRect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+struct PresentStats {
+    uint16_t rectCount = 0;
+    uint32_t pixelsChanged = 0;   // pixels that differ from the previous frame
+    uint32_t pixelsSent = 0;      // pixels actually pushed to the panel
+};
+
+class DirtyRectTracker {
+public:
+    static constexpr uint8_t MAX_RECTS = 16;
+    static constexpr int16_t MERGE_GAP = 4;   // join spans closer than this
+
+    void reset() { _count = 0; }
+
+    // Mark columns x0..x1 (inclusive) of row y as changed
+    void addRowSpan(int16_t y, int16_t x0, int16_t x1);
+
+    uint8_t count() const { return _count; }
+    const DirtyRect& rect(uint8_t i) const { return _rects[i]; }
+    uint32_t area() const;
+
+private:
+    DirtyRect _rects[MAX_RECTS];
+    uint8_t _count = 0;
+
+    static void unionInto(DirtyRect& r, int16_t y, int16_t x0, int16_t x1);
+};
@@ -0,0 +1,183 @@
+#include "FrameDelta.h"
+
+namespace {
+constexpr uint8_t INLINE_MAX = 63;
+constexpr int16_t SCRATCH_PIXELS = 64;
+constexpr size_t MIN_FILL = 3;   // shorter repeats are cheaper as literals
+
+void putRun(std::vector<uint8_t>& out, FrameDelta::Op op, size_t n) {
+    if (n < INLINE_MAX) {
+        out.push_back((uint8_t)((op << 6) | n));
+        return;
+    }
+    out.push_back((uint8_t)((op << 6) | INLINE_MAX));
+    size_t rest = n - INLINE_MAX;
+    do {
+        uint8_t b = rest & 0x7F;
+        rest >>= 7;
+        out.push_back(rest ? (b | 0x80) : b);
+    } while (rest);
+}
+
+void putColor(std::vector<uint8_t>& out, uint16_t color) {
+    out.push_back((uint8_t)(color & 0xFF));
+    out.push_back((uint8_t)(color >> 8));
+}
+
+size_t repeatLength(const uint16_t* frame, size_t from, size_t end) {
+    size_t n = 1;
+    while (from + n < end && frame[from + n] == frame[from]) n++;
+    return n;
+}
+
+// Reads runs and hands them to the sink one row segment at a time
+class Reader {
+public:
+    Reader(const uint8_t* data, size_t length) : _p(data), _end(data + length) {}
+
+    bool done() const { return _p >= _end; }
+
+    bool run(FrameDelta::Op& op, size_t& n) {
+        if (_p >= _end) return false;
+        uint8_t header = *_p++;
+        op = (FrameDelta::Op)(header >> 6);
+        n = header & INLINE_MAX;
+        if (n == INLINE_MAX) {
+            size_t rest = 0;
+            uint8_t shift = 0;
+            uint8_t b;
+            do {
+                if (_p >= _end || shift > 21) return false;
+                b = *_p++;
+                rest |= (size_t)(b & 0x7F) << shift;
+                shift += 7;
+            } while (b & 0x80);
+            n += rest;
+        }
+        return n > 0 && op <= FrameDelta::COPY;
+    }
+
+    bool color(uint16_t& c) {
+        if (_end - _p < 2) return false;
+        c = (uint16_t)(_p[0] | (_p[1] << 8));
+        _p += 2;
+        return true;
+    }
+
+    bool colors(uint16_t* dst, size_t n) {
+        if ((size_t)(_end - _p) < n * 2) return false;
+        for (size_t i = 0; i < n; i++, _p += 2) dst[i] = (uint16_t)(_p[0] | (_p[1] << 8));
+        return true;
+    }
+
+private:
+    const uint8_t* _p;
+    const uint8_t* _end;
+};
+
+template <typename Sink>
+bool decodeInto(const uint8_t* data, size_t length, Sink& sink, int16_t width, int16_t height) {
+    Reader reader(data, length);
+    const size_t total = (size_t)width * height;
+    size_t pos = 0;
+    uint16_t scratch[SCRATCH_PIXELS];
+
+    while (!reader.done()) {
+        FrameDelta::Op op;
+        size_t n;
+        if (!reader.run(op, n) || pos + n > total) return false;
+
+        if (op == FrameDelta::SKIP) {
+            pos += n;
+            continue;
+        }
+
+        uint16_t color = 0;
+        if (op == FrameDelta::FILL && !reader.color(color)) return false;
+
+        // Split at row ends (and scratch size for literals)
+        while (n > 0) {
+            int16_t x = (int16_t)(pos % width);
+            int16_t y = (int16_t)(pos / width);
+            int16_t count = (int16_t)(n < (size_t)(width - x) ? n : (size_t)(width - x));
+            if (op == FrameDelta::FILL) {
+                sink.fill(x, y, count, color);
+            } else {
+                if (count > SCRATCH_PIXELS) count = SCRATCH_PIXELS;
+                if (!reader.colors(scratch, count)) return false;
+                sink.copy(x, y, scratch, count);
+            }
+            pos += count;
+            n -= count;
+        }
+    }
+    return true;
+}
+
+struct DisplaySink {
+    IDisplay* display;
+    void fill(int16_t x, int16_t y, int16_t n, uint16_t color) { display->drawFastHLine(x, y, n, color); }
+    void copy(int16_t x, int16_t y, const uint16_t* colors, int16_t n) { display->drawSpan(x, y, colors, n); }
+};
+
+struct BufferSink {
+    uint16_t* frame;
+    int16_t width;
+    void fill(int16_t x, int16_t y, int16_t n, uint16_t color) {
+        uint16_t* dst = frame + (size_t)y * width + x;
+        for (int16_t i = 0; i < n; i++) dst[i] = color;
+    }
+    void copy(int16_t x, int16_t y, const uint16_t* colors, int16_t n) {
+        uint16_t* dst = frame + (size_t)y * width + x;
+        for (int16_t i = 0; i < n; i++) dst[i] = colors[i];
+    }
+};
+}
+
+namespace FrameDelta {
+
+void encode(const uint16_t* frame, const uint16_t* previous, int16_t width, int16_t height,
+            std::vector<uint8_t>& out) {
+    const size_t total = (size_t)width * height;
+    size_t pos = 0;
+    while (pos < total) {
+        if (previous != nullptr && frame[pos] == previous[pos]) {
+            size_t n = 1;
+            while (pos + n < total && frame[pos + n] == previous[pos + n]) n++;
+            putRun(out, SKIP, n);
+            pos += n;
+            continue;
+        }
+
+        size_t repeat = repeatLength(frame, pos, total);
+        if (repeat >= MIN_FILL) {
+            putRun(out, FILL, repeat);
+            putColor(out, frame[pos]);
+            pos += repeat;
+            continue;
+        }
+
+        // Literals until an unchanged pixel or a worthwhile repeat
+        size_t end = pos + 1;
+        while (end < total) {
+            if (previous != nullptr && frame[end] == previous[end]) break;
+            if (repeatLength(frame, end, total) >= MIN_FILL) break;
+            end++;
+        }
+        putRun(out, COPY, end - pos);
+        for (size_t i = pos; i < end; i++) putColor(out, frame[i]);
+        pos = end;
+    }
+}
+
+bool decode(const uint8_t* data, size_t length, IDisplay* display, int16_t width, int16_t height) {
+    DisplaySink sink{display};
+    return decodeInto(data, length, sink, width, height);
+}
+
+bool decode(const uint8_t* data, size_t length, uint16_t* frame, int16_t width, int16_t height) {
+    BufferSink sink{frame, width};
+    return decodeInto(data, length, sink, width, height);
+}
+
+}
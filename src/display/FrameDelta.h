@@ -0,0 +1,37 @@
+#pragma once
+
+#include "IDisplay.h"
+#include <vector>
+
+/**
+ * FrameDelta - run-length delta coding of RGB565 frames.
+ *
+ * A frame is coded in raster order as a stream of runs, each one header byte
+ * (op in the top two bits, length in the low six; 63 means a LEB128 varint
+ * with the rest follows):
+ *
+ *   SKIP n           n pixels unchanged from the previous frame
+ *   FILL n, color    n pixels of one color (2 bytes, little-endian)
+ *   COPY n, colors   n literal pixels (2 bytes each)
+ *
+ * Encoding against no previous frame gives a keyframe (no SKIPs). Decoding
+ * never needs the previous frame in RAM: it only writes the runs that
+ * changed, so the target must still hold the previous frame (Canvas565 or a
+ * single-buffered panel). Spans are decoded through a fixed 64-pixel
+ * scratch row.
+ */
+namespace FrameDelta {
+    enum Op : uint8_t {
+        SKIP = 0,
+        FILL = 1,
+        COPY = 2
+    };
+
+    // Append the coding of `frame` against `previous` (nullptr = keyframe)
+    void encode(const uint16_t* frame, const uint16_t* previous, int16_t width, int16_t height,
+                std::vector<uint8_t>& out);
+
+    // Apply one coded frame; false if the data is malformed or overruns the frame
+    bool decode(const uint8_t* data, size_t length, IDisplay* display, int16_t width, int16_t height);
+    bool decode(const uint8_t* data, size_t length, uint16_t* frame, int16_t width, int16_t height);
+}
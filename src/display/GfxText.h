@@ -0,0 +1,57 @@
+#pragma once
+
+#include "IDisplay.h"
+
+/**
+ * GfxText - Adafruit-GFX-compatible classic 5x7 text for RAM-backed displays.
+ *
+ * Mirrors Adafruit_GFX::write() semantics (6x8 cell per char at size 1,
+ * '\n' moves down one line, optional wrap at the right edge) so text drawn
+ * off-screen lands on the same pixels the panel driver would have used.
+ */
+
+namespace GfxText {
+    constexpr int16_t CHAR_W = 6;   // 5 glyph columns + 1 spacing
+    constexpr int16_t CHAR_H = 8;
+    constexpr char FIRST_CHAR = 0x20;
+    constexpr char LAST_CHAR = 0x7E;
+
+    struct Cursor {
+        int16_t x = 0;
+        int16_t y = 0;
+        uint16_t color = 0xFFFF;
+        uint8_t size = 1;
+        bool wrap = true;
+    };
+
+    // Column bitmaps for one glyph (bit 0 = top row), or nullptr if unsupported
+    const uint8_t* glyph(char c);
+
+    void drawChar(IDisplay* target, int16_t x, int16_t y, char c, uint16_t color, uint8_t size);
+    void print(IDisplay* target, Cursor& cursor, const char* text);
+
+    // Cursor walk shared by every text path: advances the cursor exactly like
+    // print() and calls fn(x, y, c) for each character cell to draw.
+    template <typename GlyphFn>
+    void layout(Cursor& cursor, int16_t targetWidth, const char* text, GlyphFn&& fn) {
+        if (text == nullptr) return;
+        uint8_t size = cursor.size > 0 ? cursor.size : 1;
+
+        for (const char* p = text; *p; p++) {
+            char c = *p;
+            if (c == '\n') {
+                cursor.x = 0;
+                cursor.y += CHAR_H * size;
+                continue;
+            }
+            if (c == '\r') continue;
+
+            if (cursor.wrap && (cursor.x + CHAR_W * size) > targetWidth) {
+                cursor.x = 0;
+                cursor.y += CHAR_H * size;
+            }
+            fn(cursor.x, cursor.y, c);
+            cursor.x += CHAR_W * size;
+        }
+    }
+}
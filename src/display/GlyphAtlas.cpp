@@ -0,0 +1,39 @@
+#include "GlyphAtlas.h"
+
+#include <Arduino.h>
+
+GlyphAtlas::GlyphAtlas(uint8_t size) : _size(size > 0 ? size : 1) {
+    const int glyphCount = GfxText::LAST_CHAR - GfxText::FIRST_CHAR + 1;
+    _offsets.reserve(glyphCount + 1);
+
+    for (int g = 0; g < glyphCount; g++) {
+        _offsets.push_back((uint16_t)_runs.size());
+        const uint8_t* columns = GfxText::glyph((char)(GfxText::FIRST_CHAR + g));
+
+        for (int16_t row = 0; row < GfxText::CHAR_H; row++) {
+            int16_t col = 0;
+            while (col < 5) {
+                while (col < 5 && !(pgm_read_byte(&columns[col]) & (1 << row))) col++;
+                int16_t runStart = col;
+                while (col < 5 && (pgm_read_byte(&columns[col]) & (1 << row))) col++;
+                if (col == runStart) continue;
+                // One run per scaled row so the blit never multiplies
+                for (int16_t sy = 0; sy < _size; sy++) {
+                    _runs.push_back({(uint8_t)(row * _size + sy), (uint8_t)(runStart * _size),
+                                     (uint8_t)((col - runStart) * _size)});
+                }
+            }
+        }
+    }
+    _offsets.push_back((uint16_t)_runs.size());
+}
+
+const GlyphAtlas::Run* GlyphAtlas::runs(char c, uint16_t& count) const {
+    if (c < GfxText::FIRST_CHAR || c > GfxText::LAST_CHAR) {
+        count = 0;
+        return nullptr;
+    }
+    int g = c - GfxText::FIRST_CHAR;
+    count = _offsets[g + 1] - _offsets[g];
+    return &_runs[_offsets[g]];
+}
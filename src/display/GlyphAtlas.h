@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "GfxText.h"
+
+/**
+ * GlyphAtlas - every GfxText glyph pre-expanded to one text size.
+ *
+ * Each glyph is stored as the horizontal runs of ink on its scaled rows, so
+ * drawing a character is a table lookup plus one fill per run instead of a
+ * walk over font column bits. Built once per size on first use.
+ */
+class GlyphAtlas {
+public:
+    struct Run {
+        uint8_t row;    // scaled row inside the cell
+        uint8_t x;      // scaled start column
+        uint8_t len;    // scaled length
+    };
+
+    explicit GlyphAtlas(uint8_t size);
+
+    uint8_t size() const { return _size; }
+    int16_t cellWidth() const { return GfxText::CHAR_W * _size; }
+    int16_t cellHeight() const { return GfxText::CHAR_H * _size; }
+
+    // Runs for c in row order; count is 0 for blanks and unsupported chars
+    const Run* runs(char c, uint16_t& count) const;
+    size_t bytes() const { return _runs.size() * sizeof(Run) + _offsets.size() * sizeof(uint16_t); }
+
+private:
+    uint8_t _size;
+    std::vector<Run> _runs;
+    std::vector<uint16_t> _offsets;   // glyph i owns _runs[_offsets[i] .. _offsets[i + 1])
+};
@@ -5,13 +5,32 @@
 
 class Hub75Display : public IDisplay {
 public:
-    explicit Hub75Display(MatrixPanel_I2S_DMA* matrix) : _matrix(matrix) {}
+    // doubleBuffered must match the double_buff flag the matrix was begun with
+    explicit Hub75Display(MatrixPanel_I2S_DMA* matrix, bool doubleBuffered = false)
+        : _matrix(matrix), _doubleBuffered(doubleBuffered) {}
+
+    int16_t width() const override { return _matrix->width(); }
+    int16_t height() const override { return _matrix->height(); }
 
     void drawPixel(int16_t x, int16_t y, uint16_t color) override { _matrix->drawPixel(x, y, color); }
     void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override { _matrix->drawLine(x0, y0, x1, y1, color); }
     void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { _matrix->drawFastHLine(x, y, w, color); }
     void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override { _matrix->drawRect(x, y, w, h, color); }
 
+    void drawSpan(int16_t x, int16_t y, const uint16_t* colors, int16_t w) override {
+        if (y < 0 || y >= _matrix->height() || w <= 0) return;
+        int16_t x0 = x < 0 ? 0 : x;
+        int16_t x1 = min<int16_t>(_matrix->width(), x + w);
+        // The driver has no multi-color row write, so this is still one driver
+        // drawPixel (with its own bounds check) per pixel. What the span saves
+        // is the IDisplay dispatch and the caller's per-pixel clipping.
+        for (int16_t px = x0; px < x1; px++) _matrix->drawPixel(px, y, colors[px - x]);
+    }
+    void drawRow(int16_t y, const uint16_t* colors) override { drawSpan(0, y, colors, _matrix->width()); }
+    void drawBitmap565(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) override {
+        for (int16_t row = 0; row < h; row++) drawSpan(x, y + row, bitmap + row * w, w);
+    }
+
     void fillScreen(uint16_t color) override { _matrix->fillScreen(color); }
     void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override { _matrix->fillRect(x, y, w, h, color); }
     void clearScreen() override { _matrix->clearScreen(); }
@@ -24,6 +43,14 @@ public:
 
     uint16_t color565(uint8_t r, uint8_t g, uint8_t b) override { return _matrix->color565(r, g, b); }
 
+    // Drawing goes to the back DMA buffer; the driver swaps it in at the end
+    // of the current scan, so the panel never shows a partial frame.
+    void flip() override {
+        if (_doubleBuffered) _matrix->flipDMABuffer();
+    }
+    uint8_t bufferCount() const override { return _doubleBuffered ? 2 : 1; }
+
 private:
     MatrixPanel_I2S_DMA* _matrix;
+    bool _doubleBuffered;
 };
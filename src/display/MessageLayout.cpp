@@ -0,0 +1,34 @@
+#include "MessageLayout.h"
+
+void MessageLayout::set(const char* text, int16_t panelWidth, int16_t panelHeight) {
+    _lineCount = 0;
+    if (text == nullptr) return;
+
+    int16_t perLine = panelWidth / GfxText::CHAR_W;
+    if (perLine > MAX_LINE_CHARS) perLine = MAX_LINE_CHARS;
+    if (perLine < 1) perLine = 1;
+
+    // Fill lines perLine characters at a time; anything past MAX_LINES is dropped
+    const char* p = text;
+    while (*p && _lineCount < MAX_LINES) {
+        Line& line = _lines[_lineCount++];
+        uint8_t n = 0;
+        while (*p && n < perLine) line.text[n++] = *p++;
+        line.text[n] = '\0';
+        line.x = (panelWidth - n * GfxText::CHAR_W) / 2;
+    }
+
+    int16_t startY = (panelHeight - _lineCount * GfxText::CHAR_H) / 2;
+    for (uint8_t i = 0; i < _lineCount; i++) {
+        _lines[i].y = startY + i * GfxText::CHAR_H;
+    }
+}
+
+void MessageLayout::draw(IDisplay* display, uint16_t color) const {
+    display->setTextColor(color);
+    display->setTextSize(1);
+    for (uint8_t i = 0; i < _lineCount; i++) {
+        display->setCursor(_lines[i].x, _lines[i].y);
+        display->print(_lines[i].text);
+    }
+}
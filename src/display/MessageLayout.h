@@ -0,0 +1,34 @@
+#pragma once
+
+#include "IDisplay.h"
+#include "GfxText.h"
+
+/**
+ * MessageLayout - wrapped, centered layout of one text message, kept in
+ * fixed storage so redraws replay it without touching the heap.
+ *
+ * set() breaks the text into lines of whole character cells (hard wrap, no
+ * word breaking), centers each line horizontally and the block vertically,
+ * and keeps each line NUL-terminated for IDisplay::print.
+ */
+class MessageLayout {
+public:
+    static constexpr uint8_t MAX_LINES = 10;
+    static constexpr uint8_t MAX_LINE_CHARS = 21;   // 128 px panel at size 1
+
+    void set(const char* text, int16_t panelWidth, int16_t panelHeight);
+    void draw(IDisplay* display, uint16_t color) const;
+
+    uint8_t lineCount() const { return _lineCount; }
+    const char* line(uint8_t i) const { return _lines[i].text; }
+
+private:
+    struct Line {
+        int16_t x;
+        int16_t y;
+        char text[MAX_LINE_CHARS + 1];
+    };
+
+    Line _lines[MAX_LINES];
+    uint8_t _lineCount = 0;
+};
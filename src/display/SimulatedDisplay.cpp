@@ -29,7 +29,8 @@ void SimulatedDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c
     if (y < 0 || y >= _height || w <= 0) return;
     int16_t x0 = std::max<int16_t>(0, x);
     int16_t x1 = std::min<int16_t>(_width - 1, x + w - 1);
-    for (int16_t px = x0; px <= x1; ++px) drawPixel(px, y, color);
+    if (x1 < x0) return;
+    std::fill_n(&_framebuffer[y * _width + x0], x1 - x0 + 1, color);
 }
 
 void SimulatedDisplay::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
@@ -40,6 +41,25 @@ void SimulatedDisplay::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint
     drawLine(x + w - 1, y, x + w - 1, y + h - 1, color);
 }
 
+void SimulatedDisplay::drawSpan(int16_t x, int16_t y, const uint16_t* colors, int16_t w) {
+    if (y < 0 || y >= _height || w <= 0) return;
+    int16_t x0 = std::max<int16_t>(0, x);
+    int16_t x1 = std::min<int16_t>(_width, x + w);
+    if (x1 <= x0) return;
+    std::copy(colors + (x0 - x), colors + (x1 - x), &_framebuffer[y * _width + x0]);
+}
+
+void SimulatedDisplay::drawRow(int16_t y, const uint16_t* colors) {
+    if (y < 0 || y >= _height) return;
+    std::copy(colors, colors + _width, &_framebuffer[y * _width]);
+}
+
+void SimulatedDisplay::drawBitmap565(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
+    for (int16_t row = 0; row < h; ++row) {
+        SimulatedDisplay::drawSpan(x, y + row, bitmap + row * w, w);
+    }
+}
+
 void SimulatedDisplay::fillScreen(uint16_t color) {
     std::fill(_framebuffer.begin(), _framebuffer.end(), color);
 }
@@ -51,10 +71,10 @@ void SimulatedDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint
     int16_t x1 = std::min<int16_t>(_width - 1, x + w - 1);
     int16_t y1 = std::min<int16_t>(_height - 1, y + h - 1);
 
+    if (x1 < x0) return;
+
     for (int16_t py = y0; py <= y1; ++py) {
-        for (int16_t px = x0; px <= x1; ++px) {
-            drawPixel(px, py, color);
-        }
+        std::fill_n(&_framebuffer[py * _width + x0], x1 - x0 + 1, color);
     }
 }
 
@@ -63,25 +83,49 @@ void SimulatedDisplay::clearScreen() {
 }
 
 void SimulatedDisplay::setCursor(int16_t x, int16_t y) {
-    _cursorX = x;
-    _cursorY = y;
+    _cursor.x = x;
+    _cursor.y = y;
 }
 
 void SimulatedDisplay::print(const char* text) {
-    (void)text;
-    // Intentionally no-op for now; animation rendering doesn't depend on text rasterization in simulator.
+    const GlyphAtlas& atlas = atlasFor(_cursor.size);
+    GfxText::layout(_cursor, _width, text, [&](int16_t x, int16_t y, char c) {
+        blitGlyph(atlas, x, y, c, _cursor.color);
+    });
 }
 
 void SimulatedDisplay::setTextColor(uint16_t color) {
-    _textColor = color;
+    _cursor.color = color;
 }
 
 void SimulatedDisplay::setTextWrap(bool wrap) {
-    _textWrap = wrap;
+    _cursor.wrap = wrap;
 }
 
 void SimulatedDisplay::setTextSize(uint8_t size) {
-    _textSize = size;
+    _cursor.size = size > 0 ? size : 1;
+}
+
+const GlyphAtlas& SimulatedDisplay::atlasFor(uint8_t size) {
+    if (size == 0) size = 1;
+    if (_atlases.size() < size) _atlases.resize(size);
+    std::unique_ptr<GlyphAtlas>& slot = _atlases[size - 1];
+    if (!slot) slot.reset(new GlyphAtlas(size));
+    return *slot;
+}
+
+void SimulatedDisplay::blitGlyph(const GlyphAtlas& atlas, int16_t x, int16_t y, char c, uint16_t color) {
+    if (x >= _width || y >= _height || x + atlas.cellWidth() <= 0 || y + atlas.cellHeight() <= 0) return;
+
+    uint16_t count = 0;
+    const GlyphAtlas::Run* runs = atlas.runs(c, count);
+    for (uint16_t i = 0; i < count; i++) {
+        int16_t py = y + runs[i].row;
+        if (py < 0 || py >= _height) continue;
+        int16_t x0 = std::max<int16_t>(0, x + runs[i].x);
+        int16_t x1 = std::min<int16_t>(_width, x + runs[i].x + runs[i].len);
+        if (x1 > x0) std::fill_n(&_framebuffer[py * _width + x0], x1 - x0, color);
+    }
 }
 
 uint16_t SimulatedDisplay::color565(uint8_t r, uint8_t g, uint8_t b) {
@@ -2,18 +2,28 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 #include <cstdint>
 #include "IDisplay.h"
+#include "GfxText.h"
+#include "GlyphAtlas.h"
 
 class SimulatedDisplay : public IDisplay {
 public:
     SimulatedDisplay(int16_t width = 64, int16_t height = 64, int pixelScale = 8);
 
+    int16_t width() const override { return _width; }
+    int16_t height() const override { return _height; }
+
     void drawPixel(int16_t x, int16_t y, uint16_t color) override;
     void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override;
     void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
     void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
 
+    void drawSpan(int16_t x, int16_t y, const uint16_t* colors, int16_t w) override;
+    void drawRow(int16_t y, const uint16_t* colors) override;
+    void drawBitmap565(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) override;
+
     void fillScreen(uint16_t color) override;
     void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
     void clearScreen() override;
@@ -34,12 +44,11 @@ private:
     int _pixelScale;
     std::vector<uint16_t> _framebuffer;
 
-    int16_t _cursorX = 0;
-    int16_t _cursorY = 0;
-    uint16_t _textColor = 0xFFFF;
-    bool _textWrap = false;
-    uint8_t _textSize = 1;
+    GfxText::Cursor _cursor;
+    std::vector<std::unique_ptr<GlyphAtlas>> _atlases;   // index = text size - 1, built on first use
 
+    const GlyphAtlas& atlasFor(uint8_t size);
+    void blitGlyph(const GlyphAtlas& atlas, int16_t x, int16_t y, char c, uint16_t color);
     uint16_t getPixel(int16_t x, int16_t y) const;
     static void rgb565To888(uint16_t c, uint8_t& r, uint8_t& g, uint8_t& b);
 };
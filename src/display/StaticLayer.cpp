@@ -0,0 +1,29 @@
+#include "StaticLayer.h"
+
+#include <new>
+
+Canvas565* StaticLayer::allocate(IDisplay* display) {
+    _canvas = new (std::nothrow) Canvas565(display->width(), display->height());
+    if (_canvas != nullptr && !_canvas->isAllocated()) release();
+    return _canvas;
+}
+
+void StaticLayer::release() {
+    delete _canvas;
+    _canvas = nullptr;
+}
+
+void StaticLayer::blit(IDisplay* display) const {
+    int16_t w = _w > 0 ? _w : _canvas->width();
+    int16_t h = _h > 0 ? _h : _canvas->height();
+    const uint16_t* pixels = _canvas->buffer();
+
+    if (_x == 0 && w == _canvas->width()) {
+        // Whole rows are contiguous: one bitmap call (a single memcpy on Canvas565)
+        display->drawBitmap565(0, _y, pixels + _y * w, w, h);
+        return;
+    }
+    for (int16_t row = _y; row < _y + h; row++) {
+        display->drawSpan(_x, row, pixels + row * _canvas->width() + _x, w);
+    }
+}
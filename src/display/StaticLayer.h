@@ -0,0 +1,57 @@
+#pragma once
+
+#include "IDisplay.h"
+#include "Canvas565.h"
+
+/**
+ * StaticLayer - the part of an animation frame that never changes, rasterized
+ * once and replayed by copy.
+ *
+ * The owning animation passes a draw function to restore(). The first call
+ * renders it into a private panel-sized canvas (panel coordinates, no
+ * offsets to think about); every call then copies the layer's region onto
+ * the display, one span per row, and the animation draws only its moving
+ * elements on top. If the canvas cannot be allocated the draw function runs
+ * against the display directly, so the frame still comes out right.
+ *
+ * Memory: width * height * 2 bytes once built (8 KB for 64x64). Call
+ * release() when the animation stops, or invalidate() if what the draw
+ * function produces has changed.
+ */
+class StaticLayer {
+public:
+    // Region copied by restore(); the default w/h of 0 means the whole panel
+    StaticLayer(int16_t x = 0, int16_t y = 0, int16_t w = 0, int16_t h = 0)
+        : _x(x), _y(y), _w(w), _h(h) {}
+    ~StaticLayer() { release(); }
+
+    StaticLayer(const StaticLayer&) = delete;
+    StaticLayer& operator=(const StaticLayer&) = delete;
+
+    template <typename DrawFn>
+    void restore(IDisplay* display, DrawFn drawBackground) {
+        if (!isBuilt()) {
+            Canvas565* canvas = allocate(display);
+            if (canvas == nullptr) {
+                drawBackground(display);
+                return;
+            }
+            drawBackground(static_cast<IDisplay*>(canvas));
+        }
+        blit(display);
+    }
+
+    bool isBuilt() const { return _canvas != nullptr; }
+    void invalidate() { release(); }
+    void release();
+
+private:
+    int16_t _x;
+    int16_t _y;
+    int16_t _w;
+    int16_t _h;
+    Canvas565* _canvas = nullptr;
+
+    Canvas565* allocate(IDisplay* display);
+    void blit(IDisplay* display) const;
+};
@@ -3,39 +3,43 @@
 #include <PubSubClient.h>
 #include <ESP32-HUB75-MatrixPanel-I2S-DMA.h>
 #include <WiFiClientSecure.h>
-#include <HTTPClient.h>
-#include <HTTPUpdate.h>
 #include <time.h>
+#include <esp_heap_caps.h>
+#include <LittleFS.h>
 #include "Secrets.h"
 #include "IDisplay.h"
 #include "display/Hub75Display.h"
+#include "display/Canvas565.h"
+#include "display/MessageLayout.h"
+#include "display/ClockWidget.h"
+#include "display/CountingDisplay.h"
+#include "core/FrameScheduler.h"
+#include "core/SpscQueue.h"
+#include "core/Command.h"
+#include "core/PinnedTask.h"
+#include "net/Reconnector.h"
+#include "net/OtaUpdater.h"
 
 // Animation includes
-#include "animations/EggChickAnimation.h"
-#include "animations/ValentineHeartbeat.h"
-#include "animations/ValentineTwoHearts.h"
-#include "animations/ValentineLoveLetter.h"
-#include "animations/ValentineTextOnly.h"
-#include "animations/ValentineTextChick.h"
-#include "animations/Chick1Animation.h"
-#include "animations/Mosq1Animation.h"
-
-// Active animation tracking
-enum class ActiveAnimation {
-    NONE,
-    EGG_CHICK,
-    VALENTINE_HEARTBEAT,
-    VALENTINE_TWO_HEARTS,
-    VALENTINE_LOVE_LETTER,
-    VALENTINE_TEXT_ONLY,
-    VALENTINE_TEXT_CHICK,
-    CHICK1,
-    MOSQ1
-};
-ActiveAnimation currentAnimation = ActiveAnimation::NONE;
+#include "animations/AnimationRegistry.h"
+#include "animations/StreamedAnimation.h"
 
 #define PANEL_WIDTH  64
 #define PANEL_HEIGHT 64
+#define PANEL_COLOR_DEPTH_BITS 3  // fewer bitplanes reduces PWM wave/banding artifacts
+
+// Tear-free mode: draw into a second DMA buffer and flip at the end of a scan.
+// Costs a full extra set of bitplane buffers in DMA-capable RAM.
+#ifndef HUB75_DOUBLE_BUFFER
+#define HUB75_DOUBLE_BUFFER 0
+#endif
+
+// Count and time every call presentFrame() makes into the HUB75 driver
+// (CountingDisplay); STATS prints the last presented frame. Adds 4 KB of RAM
+// and a cycle-counter read around each call.
+#ifndef DISPLAY_STATS
+#define DISPLAY_STATS 0
+#endif
 
 #define R1_PIN  4
 #define G1_PIN  5
@@ -57,6 +61,37 @@ ActiveAnimation currentAnimation = ActiveAnimation::NONE;
 IDisplay *display = nullptr;
 MatrixPanel_I2S_DMA *matrixDisplay = nullptr;
 Hub75Display *hub75Display = nullptr;
+#if DISPLAY_STATS
+CountingDisplay *panelStats = nullptr;
+#endif
+IDisplay *panelOutput = nullptr;  // hub75Display, or panelStats wrapped around it
+Canvas565 *frameCanvas = nullptr;  // everything draws here; presentFrame() pushes it to the panel
+
+// Static text only needs redrawing on input; this rate bounds Serial/MQTT latency
+const uint16_t IDLE_FPS = 20;
+FrameScheduler frameScheduler(IDLE_FPS);
+
+// Networking runs on core 0 next to the WiFi driver; rendering owns core 1.
+// Commands cross from the network task to the render task through a
+// lock-free queue, so a stalled connection never holds up a frame.
+const uint8_t NETWORK_CORE = 0;
+const uint8_t RENDER_CORE = 1;
+const uint32_t NETWORK_POLL_MS = 10;
+SpscQueue<Command, 8> commandQueue;
+uint32_t droppedCommands = 0;
+PinnedTask renderTask;
+PinnedTask networkTask;
+
+/**
+ * Push the changed regions of the off-screen frame to the panel and flip it
+ * into view. Called once per loop tick so the panel only ever shows complete frames.
+ */
+void presentFrame() {
+  if (frameCanvas != nullptr && frameCanvas->isDirty()) {
+    frameCanvas->present(panelOutput);
+    panelOutput->flip();
+  }
+}
 
 #ifndef FW_VERSION
 #define FW_VERSION "dev"
@@ -66,455 +101,329 @@ const uint32_t OTA_CHECK_INTERVAL_MS = 6UL * 60UL * 60UL * 1000UL;
 WiFiClientSecure wifiClient;
 PubSubClient mqttClient(wifiClient);
 
+// WiFi.begin() connects in the background: give each attempt 10 s, then
+// retry with backoff. PubSubClient::connect() settles within the call, so
+// MQTT needs no attempt timeout, only spacing between failures.
+Reconnector wifiLink(10000, 1000, 60000);
+Reconnector mqttLink(0, 1000, 60000);
+bool bootOtaCheckDone = false;
+
 String currentText = "Hello World";
+MessageLayout currentLayout;
 String lastMessageTime = "";
+ClockWidget clockWidget(PANEL_WIDTH, PANEL_HEIGHT);
 uint32_t lastOtaCheckMs = 0;
+OtaUpdater otaUpdater;
 
 const char *ntpServer = "pool.ntp.org";
 const long gmtOffset_sec = 0;
 const int daylightOffset_sec = 3600;
 
-bool otaConfigIsValid() {
-  return strlen(GITHUB_OWNER) > 0 && strlen(GITHUB_REPO) > 0;
-}
-
-String buildGithubReleaseAssetUrl(const char *assetName) {
-  String url = "https://github.com/";
-  url += GITHUB_OWNER;
-  url += "/";
-  url += GITHUB_REPO;
-  url += "/releases/latest/download/";
-  url += assetName;
-  return url;
-}
-
-int readVersionPart(const String &version, int index) {
-  int partStart = 0;
-  int currentPart = 0;
-
-  for (int i = 0; i <= version.length(); i++) {
-    if (i == version.length() || version[i] == '.') {
-      if (currentPart == index) {
-        String part = version.substring(partStart, i);
-        part.trim();
-        return part.toInt();
-      }
-      currentPart++;
-      partStart = i + 1;
+/**
+ * Draw timestamp in bottom right corner with black background for visibility
+ */
+void drawTimestamp() {
+  if (lastMessageTime.length() == 0) {
+    struct tm timeinfo;
+    if (getLocalTime(&timeinfo, 0)) {
+      char timeStr[6];
+      strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
+      lastMessageTime = String(timeStr);
     }
   }
-
-  return 0;
+  
+  clockWidget.draw(display, lastMessageTime.c_str());
 }
 
-bool isRemoteVersionNewer(const String &remoteVersion, const String &localVersion) {
-  for (int i = 0; i < 3; i++) {
-    int remotePart = readVersionPart(remoteVersion, i);
-    int localPart = readVersionPart(localVersion, i);
-    if (remotePart > localPart) {
-      return true;
-    }
-    if (remotePart < localPart) {
-      return false;
-    }
-  }
-
-  return false;
+// Re-layout only when the message changes; redraws replay the cached lines
+void setCurrentText(const String &text) {
+  currentText = text;
+  currentLayout.set(currentText.c_str(), PANEL_WIDTH, PANEL_HEIGHT);
 }
 
-String fetchRemoteVersion() {
-  WiFiClientSecure httpsClient;
-  httpsClient.setInsecure();
-
-  HTTPClient http;
-  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-  http.setConnectTimeout(8000);
-
-  String versionUrl = buildGithubReleaseAssetUrl("version.txt");
-  if (!http.begin(httpsClient, versionUrl)) {
-    return "";
-  }
+void drawText(uint8_t r, uint8_t g, uint8_t b) {
+  display->fillScreen(display->color565(0, 0, 0));
+  currentLayout.draw(display, display->color565(r, g, b));
+  drawTimestamp();
+}
 
-  http.setUserAgent("esp32-rgb-ota");
-  int statusCode = http.GET();
-  if (statusCode != HTTP_CODE_OK) {
-    http.end();
-    return "";
+/**
+ * Advance the WiFi reconnect state machine by one step (never waits)
+ */
+void serviceWiFi(uint32_t now) {
+  switch (wifiLink.tick(now, WiFi.status() == WL_CONNECTED)) {
+    case Reconnector::Action::BEGIN_ATTEMPT:
+      WiFi.mode(WIFI_STA);
+      WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+      break;
+    case Reconnector::Action::ABANDON_ATTEMPT:
+      WiFi.disconnect();
+      break;
+    default:
+      break;
   }
-
-  String remoteVersion = http.getString();
-  http.end();
-  remoteVersion.trim();
-  return remoteVersion;
 }
 
-void checkAndApplyOtaUpdate(bool forceCheck = false) {
-  if (WiFi.status() != WL_CONNECTED) {
-    return;
-  }
+void printLinkStats(const char *name, const Reconnector &link, uint32_t now) {
+  Reconnector::Stats stats = link.stats(now);
+  Serial.printf("%s: %s | %lu attempts, %lu connects, %lu drops | down %lu s total, backoff %lu ms\n",
+                name, link.isConnected() ? "up" : "down", (unsigned long)stats.attempts,
+                (unsigned long)stats.connects, (unsigned long)stats.drops,
+                (unsigned long)(stats.downMs / 1000), (unsigned long)stats.backoffMs);
+}
 
-  if (!otaConfigIsValid()) {
-    if (forceCheck) {
-      Serial.println("OTA not configured: set GITHUB_OWNER and GITHUB_REPO constants");
+/**
+ * Apply one command from the queue; CommandTable already resolved it
+ */
+void parseCommand(const Command &command) {
+  switch (command.id) {
+    case CommandId::ANIMATION:
+      animationRegistry.start(command.animation);
+      clockWidget.invalidate();  // the animation paints over the clock box
+      Serial.printf("Starting %s animation!\n", AnimationRegistry::entry(command.animation).label);
+      return;
+
+    case CommandId::PLAY_FILE:
+      // Check the file before stopping anything: a missing one keeps the current animation or message
+      if (!streamedAnimation.canPlay(command.text, command.length)) {
+        return;
+      }
+      streamedAnimation.setFile(command.text, command.length);
+      animationRegistry.start((uint8_t)AnimationRegistry::named("file"));
+      clockWidget.invalidate();
+      if (animationRegistry.running() == nullptr) {
+        drawText(255, 255, 255);  // failed after the check (e.g. out of memory): back to the message
+        return;
+      }
+      Serial.printf("Playing /anims/%s.anim\n", streamedAnimation.fileName());
+      return;
+
+    case CommandId::STOP:
+      animationRegistry.stop();
+      drawText(255, 255, 255);  // Restore text display
+      Serial.println("Animation stopped");
+      return;
+
+    case CommandId::STATS: {
+      if (frameCanvas != nullptr) {
+        const PresentStats &last = frameCanvas->lastPresentStats();
+        uint32_t frames = frameCanvas->presentCount();
+        Serial.printf("Present: last %u rects, %lu changed, %lu sent | avg %lu px/frame over %lu frames\n",
+                      last.rectCount, (unsigned long)last.pixelsChanged, (unsigned long)last.pixelsSent,
+                      (unsigned long)(frames ? frameCanvas->totalPixelsSent() / frames : 0), (unsigned long)frames);
+      }
+#if DISPLAY_STATS
+      if (panelStats != nullptr && panelStats->frameCount() > 0) {
+        const CountingDisplay::FrameStats &panel = panelStats->lastFrame();
+        Serial.printf("Panel: %lu calls, %lu us, %lu px written, overdraw %.2f (max %u)\n",
+                      (unsigned long)panel.totalCalls(), (unsigned long)(panel.totalTimeNs() / 1000),
+                      (unsigned long)panel.pixelWrites, panel.overdraw(), panel.maxWrites);
+        for (uint8_t i = 0; i < CountingDisplay::PRIMITIVE_COUNT; i++) {
+          if (panel.calls[i] == 0) continue;
+          Serial.printf("  %-14s %5lu calls, %lu us\n", CountingDisplay::primitiveName((CountingDisplay::Primitive)i),
+                        (unsigned long)panel.calls[i], (unsigned long)(panel.timeNs[i] / 1000));
+        }
+      }
+#endif
+      FrameScheduler::Stats pacing = frameScheduler.stats();
+      Serial.printf("Frames: target %u fps, achieved %.1f | jitter avg %lu us, max %lu us | %lu late, %lu steps dropped\n",
+                    frameScheduler.targetFps(), pacing.fps, (unsigned long)pacing.jitterAvgUs,
+                    (unsigned long)pacing.jitterMaxUs, (unsigned long)pacing.lateFrames, (unsigned long)pacing.droppedSteps);
+      frameScheduler.resetStats();
+      Serial.printf("Commands: %u queued, %lu dropped\n", (unsigned)commandQueue.size(), (unsigned long)droppedCommands);
+      printLinkStats("WiFi", wifiLink, millis());
+      printLinkStats("MQTT", mqttLink, millis());
+      Serial.printf("OTA: %s, %u%%\n", OtaUpdater::phaseName(otaUpdater.phase()), otaUpdater.percent());
+      return;
     }
-    return;
-  }
-
-  uint32_t now = millis();
-  if (!forceCheck && (now - lastOtaCheckMs) < OTA_CHECK_INTERVAL_MS) {
-    return;
-  }
-  lastOtaCheckMs = now;
 
-  String localVersion = FW_VERSION;
-  localVersion.trim();
-  String remoteVersion = fetchRemoteVersion();
+    case CommandId::TEXT:
+      break;
 
-  if (remoteVersion.length() == 0) {
-    if (forceCheck) {
-      Serial.println("OTA check failed: could not fetch version.txt from GitHub");
-    }
-    return;
+    default:
+      return;  // NONE and OTA_CHECK never reach the render task
   }
 
-  Serial.printf("OTA check local=%s remote=%s\n", localVersion.c_str(), remoteVersion.c_str());
-
-  if (!forceCheck && !isRemoteVersionNewer(remoteVersion, localVersion)) {
-    return;
-  }
+  // Stop any running animation when new text arrives
+  animationRegistry.stop();
 
-  if (forceCheck && !isRemoteVersionNewer(remoteVersion, localVersion)) {
-    Serial.println("OTA: already at latest firmware");
+  // "TEXT:" is already stripped; an empty message only stops the animation
+  if (command.empty()) {
     return;
   }
+  setCurrentText(String(command.text));
 
-  WiFiClientSecure updateClient;
-  updateClient.setInsecure();
-
-  String firmwareUrl = buildGithubReleaseAssetUrl("firmware.bin");
-  Serial.printf("OTA: downloading %s\n", firmwareUrl.c_str());
-
-  t_httpUpdate_return result = httpUpdate.update(updateClient, firmwareUrl);
-  switch (result) {
-    case HTTP_UPDATE_FAILED:
-      Serial.printf("OTA failed (%d): %s\n", httpUpdate.getLastError(), httpUpdate.getLastErrorString().c_str());
-      break;
-    case HTTP_UPDATE_NO_UPDATES:
-      Serial.println("OTA: no update available");
-      break;
-    case HTTP_UPDATE_OK:
-      Serial.println("OTA: update successful, rebooting...");
-      break;
+  // Update timestamp
+  struct tm timeinfo;
+  if (getLocalTime(&timeinfo, 0)) {
+    char timeStr[6];
+    strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
+    lastMessageTime = String(timeStr);
   }
-}
 
-// Tiny 4x5 pixel font for digits and colon
-const uint8_t tinyDigits[11][5] = {
-  {0b1111, 0b1001, 0b1001, 0b1001, 0b1111}, // 0
-  {0b0010, 0b0110, 0b0010, 0b0010, 0b0111}, // 1
-  {0b1111, 0b0001, 0b1111, 0b1000, 0b1111}, // 2
-  {0b1111, 0b0001, 0b1111, 0b0001, 0b1111}, // 3
-  {0b1001, 0b1001, 0b1111, 0b0001, 0b0001}, // 4
-  {0b1111, 0b1000, 0b1111, 0b0001, 0b1111}, // 5
-  {0b1111, 0b1000, 0b1111, 0b1001, 0b1111}, // 6
-  {0b1111, 0b0001, 0b0001, 0b0001, 0b0001}, // 7
-  {0b1111, 0b1001, 0b1111, 0b1001, 0b1111}, // 8
-  {0b1111, 0b1001, 0b1111, 0b0001, 0b1111}, // 9
-  {0b0000, 0b0100, 0b0000, 0b0100, 0b0000}  // : (colon)
-};
-
-void drawTinyDigit(char c, int16_t x, int16_t y, uint16_t color) {
-  int digit = -1;
-  if (c >= '0' && c <= '9') {
-    digit = c - '0';
-  } else if (c == ':') {
-    digit = 10;
-  } else {
-    return;
-  }
-  
-  for (int row = 0; row < 5; row++) {
-    uint8_t rowData = tinyDigits[digit][row];
-    for (int col = 0; col < 4; col++) {
-      if (rowData & (1 << (3 - col))) {
-        display->drawPixel(x + col, y + row, color);
-      }
-    }
-  }
+  drawText(255, 255, 255);
 }
 
 /**
- * Draw timestamp in bottom right corner with black background for visibility
+ * Route one MQTT payload or Serial line (network task). OTA checks run right
+ * here; everything else is for the render task, which owns the display.
  */
-void drawTimestamp() {
-  if (lastMessageTime.length() == 0) {
-    struct tm timeinfo;
-    if (getLocalTime(&timeinfo)) {
-      char timeStr[6];
-      strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-      lastMessageTime = String(timeStr);
-    }
-  }
-  
-  if (lastMessageTime.length() > 0) {
-    int charWidth = 4;
-    int spacing = 1;
-    int totalWidth = lastMessageTime.length() * (charWidth + spacing) - spacing;
-    int timeX = PANEL_WIDTH - totalWidth - 3;
-    int timeY = PANEL_HEIGHT - 7;
-    
-    // Draw black background box with 1px padding
-    display->fillRect(timeX - 2, timeY - 1, totalWidth + 4, 7, display->color565(0, 0, 0));
-    
-    // Draw time in bright white
-    uint16_t timeColor = display->color565(255, 255, 255);
-    for (size_t i = 0; i < lastMessageTime.length(); i++) {
-      drawTinyDigit(lastMessageTime[i], timeX + i * (charWidth + spacing), timeY, timeColor);
-    }
+void handleIncoming(const char *text, size_t length) {
+  Command command = Command::parse(text, length);
+  if (command.id == CommandId::NONE) {
+    return;
   }
-}
 
-void drawText(const String &text, uint8_t r, uint8_t g, uint8_t b) {
-  display->fillScreen(display->color565(0, 0, 0));
-  display->setTextColor(display->color565(r, g, b));
-  
-  const int charWidth = 6;
-  const int charHeight = 8;
-  const int maxCharsPerLine = PANEL_WIDTH / charWidth;
-  
-  String lines[10];
-  int lineCount = 0;
-  String currentLine = "";
-  
-  for (unsigned int i = 0; i < text.length() && lineCount < 10; i++) {
-    if (currentLine.length() >= (unsigned int)maxCharsPerLine) {
-      lines[lineCount++] = currentLine;
-      currentLine = "";
+  if (command.id == CommandId::OTA_CHECK) {
+    if (!otaUpdater.request(true) && otaUpdater.isBusy()) {
+      Serial.printf("OTA: already %s\n", OtaUpdater::phaseName(otaUpdater.phase()));
     }
-    currentLine += text[i];
-  }
-  if (currentLine.length() > 0 && lineCount < 10) {
-    lines[lineCount++] = currentLine;
+    return;
   }
-  
-  int totalHeight = lineCount * charHeight;
-  int startY = (PANEL_HEIGHT - totalHeight) / 2;
-  
-  display->setTextSize(1);
-  for (int i = 0; i < lineCount; i++) {
-    int lineWidth = lines[i].length() * charWidth;
-    int x = (PANEL_WIDTH - lineWidth) / 2;
-    int y = startY + (i * charHeight);
-    display->setCursor(x, y);
-    display->print(lines[i].c_str());
+
+  if (!commandQueue.push(command)) {
+    droppedCommands++;
+    Serial.printf("Command queue full, dropped: %.*s\n", (int)length, text);
   }
-  
-  drawTimestamp();
 }
 
-void connectWiFi() {
-  if (WiFi.status() == WL_CONNECTED) {
+void mqttCallback(char *topic, byte *payload, unsigned int length) {
+  if (strcmp(topic, MQTT_TOPIC_TEXT) != 0) {
     return;
   }
-
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-  
-  display->fillScreen(0);
-  display->setTextColor(display->color565(100, 100, 255));
-  display->setCursor(8, 28);
-  display->print("WiFi...");
-  
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 40) {
-    delay(250);
-    attempts++;
-  }
+  handleIncoming(reinterpret_cast<const char *>(payload), length);
 }
 
 /**
- * Stop all animations
+ * Advance the MQTT reconnect state machine by one step. An attempt is a
+ * single connect() call; failures are spaced out by the backoff.
  */
-void stopAllAnimations() {
-    eggChickAnimation.stop();
-    valentineHeartbeat.stop();
-    valentineTwoHearts.stop();
-    valentineLoveLetter.stop();
-    valentineTextOnly.stop();
-    valentineTextChick.stop();
-    chick1Animation.stop();
-    mosq1Animation.stop();
-    currentAnimation = ActiveAnimation::NONE;
-}
+void serviceMQTT(uint32_t now) {
+  bool wifiUp = wifiLink.isConnected();
+  switch (mqttLink.tick(now, mqttClient.connected(), wifiUp)) {
+    case Reconnector::Action::BEGIN_ATTEMPT: {
+      String clientId = "esp32-rgb-" + String(static_cast<uint32_t>(ESP.getEfuseMac()), HEX);
+      if (mqttClient.connect(clientId.c_str(), MQTT_USERNAME, MQTT_PASSWORD)) {
+        mqttClient.subscribe(MQTT_TOPIC_TEXT);
+      }
+      break;
+    }
+    case Reconnector::Action::ABANDON_ATTEMPT:
+      mqttClient.disconnect();
+      break;
+    default:
+      break;
+  }
 
-/**
- * Check if any animation is currently running
- */
-bool isAnyAnimationRunning() {
-    return eggChickAnimation.isRunning() ||
-           valentineHeartbeat.isRunning() ||
-           valentineTwoHearts.isRunning() ||
-           valentineLoveLetter.isRunning() ||
-           valentineTextOnly.isRunning() ||
-           valentineTextChick.isRunning() ||
-           chick1Animation.isRunning() ||
-           mosq1Animation.isRunning();
+  if (mqttClient.connected()) {
+    mqttClient.loop();
+  }
 }
 
 /**
- * Parse incoming MQTT/Serial command
+ * One frame on the render task: apply queued commands, then update and draw
+ * the active animation (or the text display) and present it.
  */
-void parseCommand(const String &command) {
-  // === Valentine Animation Commands ===
-  // ANIM:VAL1 - Heartbeat pulse animation
-  if (command == "ANIM:VAL1" || command == "val1" || command == "heartbeat" || command == "pulse") {
-    stopAllAnimations();
-    valentineHeartbeat.start();
-    currentAnimation = ActiveAnimation::VALENTINE_HEARTBEAT;
-    Serial.println("Starting Valentine Heartbeat animation!");
-    return;
-  }
-  
-  // ANIM:VAL2 - Two hearts become one
-  if (command == "ANIM:VAL2" || command == "val2" || command == "twohearts" || command == "love") {
-    stopAllAnimations();
-    valentineTwoHearts.start();
-    currentAnimation = ActiveAnimation::VALENTINE_TWO_HEARTS;
-    Serial.println("Starting Valentine Two Hearts animation!");
-    return;
-  }
-  
-  // ANIM:VAL3 - Love letter animation
-  if (command == "ANIM:VAL3" || command == "val3" || command == "letter" || command == "envelope") {
-    stopAllAnimations();
-    valentineLoveLetter.start();
-    currentAnimation = ActiveAnimation::VALENTINE_LOVE_LETTER;
-    Serial.println("Starting Valentine Love Letter animation!");
-    return;
-  }
+void renderTick() {
+  static unsigned long lastTimeUpdate = 0;
+  static bool animationWasRunning = false;
 
-  // ANIM:VAL4 - Text-only I <3 YOU on black
-  if (command == "ANIM:VAL4" || command == "val4" || command == "textlove" || command == "ily") {
-    stopAllAnimations();
-    valentineTextOnly.start();
-    currentAnimation = ActiveAnimation::VALENTINE_TEXT_ONLY;
-    Serial.println("Starting Valentine Text-Only animation!");
-    return;
+  // Pace the loop: sleep until the next frame at the active animation's rate
+  IAnimation *paced = animationRegistry.running();
+  uint16_t fps = paced != nullptr ? paced->targetFps() : IDLE_FPS;
+  if (fps != frameScheduler.targetFps()) {
+    frameScheduler.setRate(fps);
   }
+  uint8_t updateSteps = frameScheduler.waitForFrame();
 
-  // ANIM:VAL5 - Text-only base with walking chick
-  if (command == "ANIM:VAL5" || command == "val5" || command == "chicklove" || command == "ilychick") {
-    stopAllAnimations();
-    valentineTextChick.start();
-    currentAnimation = ActiveAnimation::VALENTINE_TEXT_CHICK;
-    Serial.println("Starting Valentine Text + Chick animation!");
-    return;
+  Command command;
+  while (commandQueue.pop(command)) {
+    parseCommand(command);
   }
 
-  // CHICK1 - Front-facing chick with broken shell top/bottom
-  if (command == "ANIM:CHICK1" || command == "chick1" || command == "cutechick") {
-    stopAllAnimations();
-    chick1Animation.start();
-    currentAnimation = ActiveAnimation::CHICK1;
-    Serial.println("Starting CHICK1 animation!");
-    return;
-  }
+  unsigned long now = millis();
 
-  // MOSQ1 - White/blue mosque with crescent and blinking stars
-  if (command == "ANIM:MOSQ1" || command == "mosq1" || command == "mosque") {
-    stopAllAnimations();
-    mosq1Animation.start();
-    currentAnimation = ActiveAnimation::MOSQ1;
-    Serial.println("Starting MOSQ1 animation!");
-    return;
-  }
-  
-  // Egg/Chick animation commands
-  if (command == "egg" || command == "hatch" || command == "animation/egg_chick" || command == "chick") {
-    stopAllAnimations();
-    eggChickAnimation.start();
-    currentAnimation = ActiveAnimation::EGG_CHICK;
-    Serial.println("Starting egg hatching animation!");
-    return;
+  // Handle animation if running (takes priority over text display)
+  IAnimation *animation = animationRegistry.running();
+  if (animation != nullptr) {
+    animationWasRunning = true;
+    
+    // Fixed-timestep updates, then one render of the latest state. Only the
+    // frame players step per update(); the procedural animations read millis().
+    for (uint8_t i = 0; i < updateSteps; i++) {
+      animation->update();
+    }
+    animation->render();
+    
+    presentFrame();
+    return;  // Skip normal display updates while animating
   }
   
-  // Stop command
-  if (command == "stop" || command == "animation/stop" || command == "ANIM:STOP") {
-    stopAllAnimations();
-    drawText(currentText, 255, 255, 255);  // Restore text display
-    Serial.println("Animation stopped");
-    return;
+  // Restore text display when animation completes
+  if (animationWasRunning) {
+    animationWasRunning = false;
+    animationRegistry.stop();
+    drawText(255, 255, 255);
+    Serial.println("Animation complete, restored text display");
   }
 
-  if (command == "OTA:CHECK" || command == "ota" || command == "update") {
-    checkAndApplyOtaUpdate(true);
-    return;
-  }
-  
-  // Stop any running animation when new text arrives
-  if (isAnyAnimationRunning()) {
-    stopAllAnimations();
-  }
-  
-  if (command.startsWith("TEXT:")) {
-    String text = command.substring(5);
-    text.trim();
-    if (text.length() > 0) {
-      currentText = text;
-      
-      // Update timestamp
-      struct tm timeinfo;
-      if (getLocalTime(&timeinfo)) {
-        char timeStr[6];
-        strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-        lastMessageTime = String(timeStr);
-      }
-      
-      drawText(currentText, 255, 255, 255);
-    }
-  } else {
-    // Treat any other command as direct text
-    currentText = command;
-    
-    // Update timestamp
+  // Update time every minute (only when not animating)
+  if (now - lastTimeUpdate > 60000) {
+    lastTimeUpdate = now;
     struct tm timeinfo;
-    if (getLocalTime(&timeinfo)) {
+    if (getLocalTime(&timeinfo, 0)) {
       char timeStr[6];
       strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
       lastMessageTime = String(timeStr);
+      // Repaint only the clock digits that changed
+      if (!clockWidget.update(display, timeStr)) {
+        drawText(255, 255, 255);
+      }
     }
-    
-    drawText(currentText, 255, 255, 255);
   }
+
+  presentFrame();
 }
 
-void mqttCallback(char *topic, byte *payload, unsigned int length) {
-  if (strcmp(topic, MQTT_TOPIC_TEXT) != 0) {
-    return;
+/**
+ * One pass of the network task: keep WiFi and MQTT up, schedule OTA checks
+ * and collect Serial/MQTT input. Blocking here only delays commands, not frames.
+ */
+void networkTick() {
+  uint32_t now = millis();
+
+  serviceWiFi(now);
+
+  // One check as soon as WiFi first comes up, then periodically. The
+  // OTA task does the work; this only hands it the request.
+  if (wifiLink.isConnected()) {
+    if (!bootOtaCheckDone) {
+      bootOtaCheckDone = otaUpdater.request(true);
+      lastOtaCheckMs = now;
+    } else if (now - lastOtaCheckMs >= OTA_CHECK_INTERVAL_MS && otaUpdater.request(false)) {
+      lastOtaCheckMs = now;
+    }
   }
 
-  String incoming;
-  incoming.reserve(length);
-  for (unsigned int i = 0; i < length; i++) {
-    incoming += static_cast<char>(payload[i]);
+  serviceMQTT(now);
+
+  // Handle Serial input
+  if (Serial.available()) {
+    String incoming = Serial.readStringUntil('\n');
+    handleIncoming(incoming.c_str(), incoming.length());
   }
-  incoming.trim();
+}
 
-  if (incoming.length() > 0) {
-    parseCommand(incoming);
+void renderTaskMain(void *) {
+  for (;;) {
+    renderTick();
   }
 }
 
-void connectMQTT() {
-  int attempts = 0;
-  while (!mqttClient.connected() && attempts < 5) {
-    String clientId = "esp32-rgb-" + String(static_cast<uint32_t>(ESP.getEfuseMac()), HEX);
-    if (mqttClient.connect(clientId.c_str(), MQTT_USERNAME, MQTT_PASSWORD)) {
-      mqttClient.subscribe(MQTT_TOPIC_TEXT);
-    } else {
-      delay(500);
-      attempts++;
-    }
+void networkTaskMain(void *) {
+  for (;;) {
+    networkTick();
+    delay(NETWORK_POLL_MS);
   }
 }
 
@@ -541,23 +450,36 @@ void setup() {
   cfg.i2sspeed = HUB75_I2S_CFG::HZ_15M;  // higher refresh to reduce visible scan waves
   // cfg.i2sspeed = HUB75_I2S_CFG::HZ_20M;  // 20MHz - original (too fast)
   
-  cfg.double_buff = false;
-  cfg.setPixelColorDepthBits(3); // fewer bitplanes reduces PWM wave/banding artifacts
+  cfg.double_buff = HUB75_DOUBLE_BUFFER;
+  cfg.setPixelColorDepthBits(PANEL_COLOR_DEPTH_BITS);
   cfg.min_refresh_rate = 120;
   cfg.latch_blanking = 3;  // balance ghosting vs refresh flicker
 
   matrixDisplay = new MatrixPanel_I2S_DMA(cfg);
 
+  size_t dmaFreeBefore = heap_caps_get_free_size(MALLOC_CAP_DMA);
   if (!matrixDisplay->begin()) {
     Serial.println("Matrix init failed!");
     while (true);
   }
+  size_t dmaFreeAfter = heap_caps_get_free_size(MALLOC_CAP_DMA);
+  Serial.printf("HUB75 DMA buffers: %u bytes (%s, %d-bit color), %u bytes DMA RAM left\n",
+                (unsigned)(dmaFreeBefore - dmaFreeAfter),
+                HUB75_DOUBLE_BUFFER ? "double-buffered" : "single-buffered",
+                PANEL_COLOR_DEPTH_BITS, (unsigned)dmaFreeAfter);
 
   matrixDisplay->setBrightness8(110);
   matrixDisplay->clearScreen();
 
-  hub75Display = new Hub75Display(matrixDisplay);
-  display = hub75Display;
+  hub75Display = new Hub75Display(matrixDisplay, HUB75_DOUBLE_BUFFER);
+  panelOutput = hub75Display;
+#if DISPLAY_STATS
+  panelStats = new CountingDisplay(*hub75Display, true, true);
+  panelOutput = panelStats;
+#endif
+  frameCanvas = new Canvas565(PANEL_WIDTH, PANEL_HEIGHT);
+  frameCanvas->setTargetBuffers(hub75Display->bufferCount());
+  display = frameCanvas;
 
   display->setTextWrap(false);
   display->setTextSize(1);
@@ -569,43 +491,31 @@ void setup() {
   display->print("RGB Matrix");
   display->setCursor(16, 38);
   display->print("Display");
+  presentFrame();
   delay(2000);
 
-  connectWiFi();
-  
+  // WiFi and MQTT come up in the background on the network task; SNTP
+  // starts syncing once WiFi is up and drawTimestamp() picks the time up then
+  serviceWiFi(millis());
   configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
   
-  struct tm timeinfo;
-  for (int i = 0; i < 10; i++) {
-    if (getLocalTime(&timeinfo)) {
-      char timeStr[6];
-      strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-      lastMessageTime = String(timeStr);
-      break;
-    }
-    delay(500);
-  }
-  
   wifiClient.setInsecure();
   mqttClient.setServer(MQTT_HOST, MQTT_PORT);
   mqttClient.setCallback(mqttCallback);
-  connectMQTT();
   
   // Initialize animation system
-  eggChickAnimation.init(display);
-  valentineHeartbeat.init(display);
-  valentineTwoHearts.init(display);
-  valentineLoveLetter.init(display);
-  valentineTextOnly.init(display);
-  valentineTextChick.init(display);
-  chick1Animation.init(display);
-  mosq1Animation.init(display);
+  animationRegistry.initAll(display);
+  if (!LittleFS.begin()) {
+    Serial.println("LittleFS mount failed: FILE: animations unavailable");
+  }
   
   // Display initial text
-  drawText(currentText, 255, 255, 255);
+  setCurrentText(currentText);
+  drawText(255, 255, 255);
+  presentFrame();
 
   Serial.printf("Firmware version: %s\n", FW_VERSION);
-  checkAndApplyOtaUpdate(true);
+  otaUpdater.begin(GITHUB_OWNER, GITHUB_REPO, FW_VERSION, NETWORK_CORE);
   
   Serial.println("RGB Matrix Display Ready!");
   Serial.println("Commands: TEXT:message or direct text");
@@ -618,118 +528,16 @@ void setup() {
   Serial.println("  ANIM:VAL5, val5   - I <3 YOU + Walking Chick");
   Serial.println("  ANIM:CHICK1       - Cute Chick in Broken Shell");
   Serial.println("  ANIM:MOSQ1        - White/Blue Mosque + Stars");
+  Serial.println("  FILE:<name>       - Play /anims/<name>.anim from LittleFS");
   Serial.println("  stop              - Stop any animation");
   Serial.println("  OTA:CHECK         - Force OTA check now");
   Serial.println("MQTT Topic: esp32/rgb/text");
+
+  renderTask.start("render", renderTaskMain, nullptr, RENDER_CORE, 8192, 2);
+  networkTask.start("network", networkTaskMain, nullptr, NETWORK_CORE, 12288, 1);
 }
 
 void loop() {
-  static unsigned long lastWifiCheck = 0;
-  static unsigned long lastTimeUpdate = 0;
-  static bool animationWasRunning = false;
-  
-  unsigned long now = millis();
-  
-  // Check WiFi every 30 seconds
-  if (now - lastWifiCheck > 30000) {
-    lastWifiCheck = now;
-    if (WiFi.status() != WL_CONNECTED) {
-      connectWiFi();
-    }
-  }
-
-  checkAndApplyOtaUpdate(false);
-
-  // Keep MQTT connected
-  if (!mqttClient.connected()) {
-    connectMQTT();
-  }
-  mqttClient.loop();
-
-  // Handle animation if running (takes priority over text display)
-  if (isAnyAnimationRunning()) {
-    animationWasRunning = true;
-    
-    // Update and render the active animation
-    switch (currentAnimation) {
-      case ActiveAnimation::EGG_CHICK:
-        eggChickAnimation.update();
-        eggChickAnimation.render();
-        break;
-      case ActiveAnimation::VALENTINE_HEARTBEAT:
-        valentineHeartbeat.update();
-        valentineHeartbeat.render();
-        break;
-      case ActiveAnimation::VALENTINE_TWO_HEARTS:
-        valentineTwoHearts.update();
-        valentineTwoHearts.render();
-        break;
-      case ActiveAnimation::VALENTINE_LOVE_LETTER:
-        valentineLoveLetter.update();
-        valentineLoveLetter.render();
-        break;
-      case ActiveAnimation::VALENTINE_TEXT_ONLY:
-        valentineTextOnly.update();
-        valentineTextOnly.render();
-        break;
-      case ActiveAnimation::VALENTINE_TEXT_CHICK:
-        valentineTextChick.update();
-        valentineTextChick.render();
-        break;
-      case ActiveAnimation::CHICK1:
-        chick1Animation.update();
-        chick1Animation.render();
-        break;
-      case ActiveAnimation::MOSQ1:
-        mosq1Animation.update();
-        mosq1Animation.render();
-        break;
-      default:
-        break;
-    }
-    
-    // Still handle Serial input during animation
-    if (Serial.available()) {
-      String incoming = Serial.readStringUntil('\n');
-      incoming.trim();
-      if (incoming.length() > 0) {
-        parseCommand(incoming);
-      }
-    }
-    
-    delay(1);
-    return;  // Skip normal display updates while animating
-  }
-  
-  // Restore text display when animation completes
-  if (animationWasRunning && !isAnyAnimationRunning()) {
-    animationWasRunning = false;
-    currentAnimation = ActiveAnimation::NONE;
-    drawText(currentText, 255, 255, 255);
-    Serial.println("Animation complete, restored text display");
-  }
-
-  // Update time every minute (only when not animating)
-  if (now - lastTimeUpdate > 60000) {
-    lastTimeUpdate = now;
-    struct tm timeinfo;
-    if (getLocalTime(&timeinfo)) {
-      char timeStr[6];
-      strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-      lastMessageTime = String(timeStr);
-      // Redraw to update timestamp
-      drawText(currentText, 255, 255, 255);
-    }
-  }
-
-  // Handle Serial input
-  if (Serial.available()) {
-    String incoming = Serial.readStringUntil('\n');
-    incoming.trim();
-    if (incoming.length() > 0) {
-      parseCommand(incoming);
-    }
-  }
-
-  delay(1);
+  // All work happens on renderTask and networkTask; give back this task's stack
+  vTaskDelete(nullptr);
 }
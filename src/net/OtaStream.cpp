@@ -0,0 +1,75 @@
+#include "OtaStream.h"
+
+bool OtaStream::begin(Source* source, Sink* sink, size_t totalBytes, uint32_t now) {
+    _source = source;
+    _sink = sink;
+    _total = totalBytes;
+    _done = 0;
+    _lastDataMs = now;
+    _error = Error::NONE;
+    _state = State::STREAMING;
+    if (source == nullptr || sink == nullptr || !sink->begin(totalBytes)) {
+        fail(Error::BEGIN_FAILED);
+        return false;
+    }
+    return true;
+}
+
+OtaStream::State OtaStream::step(uint32_t now) {
+    if (_state != State::STREAMING) return _state;
+
+    size_t want = CHUNK_SIZE;
+    if (_total > 0 && _total - _done < want) want = _total - _done;
+
+    int got = _source->read(_buffer, want);
+    if (got < 0) {
+        // Closed: fine when the length was unknown, truncated otherwise
+        return _total == 0 && _done > 0 ? complete() : fail(Error::TRUNCATED);
+    }
+    if (got == 0) {
+        if (now - _lastDataMs >= STALL_TIMEOUT_MS) return fail(Error::STALLED);
+        return _state;
+    }
+
+    if (!_sink->write(_buffer, (size_t)got)) return fail(Error::WRITE_FAILED);
+    _done += (size_t)got;
+    _lastDataMs = now;
+
+    if (_total > 0 && _done >= _total) return complete();
+    return _state;
+}
+
+void OtaStream::cancel() {
+    if (_state == State::STREAMING) _sink->abort();
+    _state = State::IDLE;
+}
+
+uint8_t OtaStream::percent() const {
+    if (_total == 0) return _state == State::DONE ? 100 : 0;
+    return (uint8_t)((uint64_t)_done * 100 / _total);
+}
+
+OtaStream::State OtaStream::fail(Error error) {
+    if (_sink != nullptr) _sink->abort();
+    _error = error;
+    _state = State::FAILED;
+    return _state;
+}
+
+OtaStream::State OtaStream::complete() {
+    if (!_sink->finish()) return fail(Error::FINISH_FAILED);
+    _state = State::DONE;
+    return _state;
+}
+
+const char* OtaStream::errorName(Error error) {
+    switch (error) {
+        case Error::NONE: return "none";
+        case Error::BEGIN_FAILED: return "begin failed";
+        case Error::STALLED: return "stalled";
+        case Error::WRITE_FAILED: return "write failed";
+        case Error::TRUNCATED: return "truncated";
+        case Error::FINISH_FAILED: return "finish failed";
+    }
+    return "?";
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * OtaStream - moves a firmware image from a byte source to a flash sink one
+ * bounded chunk at a time.
+ *
+ * Each step() copies at most CHUNK_SIZE bytes through a fixed buffer, so
+ * memory use does not depend on the image size and the caller can yield,
+ * report progress or give up between chunks. The source and sink are small
+ * interfaces: on the device they wrap HTTPClient's stream and the Update
+ * library, on the host an in-memory server and a checksum, which keeps the
+ * chunking, size and stall handling testable off-target.
+ */
+class OtaStream {
+public:
+    static constexpr size_t CHUNK_SIZE = 1024;
+    static constexpr uint32_t STALL_TIMEOUT_MS = 15000;
+
+    class Source {
+    public:
+        virtual ~Source() = default;
+        // Bytes copied into buf; 0 when nothing has arrived yet, -1 once the
+        // stream has closed or failed
+        virtual int read(uint8_t* buf, size_t maxLen) = 0;
+    };
+
+    class Sink {
+    public:
+        virtual ~Sink() = default;
+        // totalBytes is 0 when the server sent no Content-Length
+        virtual bool begin(size_t totalBytes) = 0;
+        virtual bool write(const uint8_t* data, size_t len) = 0;
+        virtual bool finish() = 0;
+        virtual void abort() = 0;
+    };
+
+    enum class State : uint8_t { IDLE, STREAMING, DONE, FAILED };
+    enum class Error : uint8_t { NONE, BEGIN_FAILED, STALLED, WRITE_FAILED, TRUNCATED, FINISH_FAILED };
+
+    bool begin(Source* source, Sink* sink, size_t totalBytes, uint32_t now);
+    State step(uint32_t now);
+    void cancel();
+
+    State state() const { return _state; }
+    Error error() const { return _error; }
+    size_t bytesDone() const { return _done; }
+    size_t totalBytes() const { return _total; }
+    // 0-100; stays 0 until done when the total is unknown
+    uint8_t percent() const;
+
+    static const char* errorName(Error error);
+
+private:
+    Source* _source = nullptr;
+    Sink* _sink = nullptr;
+    State _state = State::IDLE;
+    Error _error = Error::NONE;
+    size_t _total = 0;
+    size_t _done = 0;
+    uint32_t _lastDataMs = 0;
+    uint8_t _buffer[CHUNK_SIZE];
+
+    State fail(Error error);
+    State complete();
+};
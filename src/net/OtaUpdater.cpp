@@ -0,0 +1,212 @@
+#include "OtaUpdater.h"
+
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include <Update.h>
+
+#include "OtaStream.h"
+#include "OtaVersion.h"
+
+namespace {
+constexpr uint32_t IDLE_POLL_MS = 100;
+constexpr uint32_t CONNECT_TIMEOUT_MS = 8000;
+
+// Body of an HTTPClient response, as far as it has arrived
+class HttpBodySource : public OtaStream::Source {
+public:
+    explicit HttpBodySource(WiFiClient* stream) : _stream(stream) {}
+
+    int read(uint8_t* buf, size_t maxLen) override {
+        int available = _stream->available();
+        if (available <= 0) return _stream->connected() ? 0 : -1;
+        return _stream->read(buf, min((size_t)available, maxLen));
+    }
+
+private:
+    WiFiClient* _stream;
+};
+
+// The inactive OTA partition, via the Update library
+class UpdatePartitionSink : public OtaStream::Sink {
+public:
+    bool begin(size_t totalBytes) override {
+        return Update.begin(totalBytes > 0 ? totalBytes : UPDATE_SIZE_UNKNOWN);
+    }
+    bool write(const uint8_t* data, size_t len) override {
+        return Update.write(const_cast<uint8_t*>(data), len) == len;
+    }
+    bool finish() override { return Update.end(true); }
+    void abort() override { Update.abort(); }
+};
+}
+
+void OtaUpdater::begin(const char* owner, const char* repo, const char* localVersion, uint8_t core) {
+    _owner = owner;
+    _repo = repo;
+    _localVersion = localVersion;
+    if (strlen(_owner) == 0 || strlen(_repo) == 0) {
+        setPhase(Phase::NOT_CONFIGURED);
+        return;
+    }
+    // TLS handshakes need a deep stack; lowest priority so it only uses spare time
+    _task.start("ota", taskMain, this, core, 12288, 0);
+}
+
+bool OtaUpdater::isBusy() const {
+    Phase p = phase();
+    return _requested.load() || p == Phase::CHECKING || p == Phase::DOWNLOADING || p == Phase::REBOOTING;
+}
+
+bool OtaUpdater::request(bool force) {
+    if (phase() == Phase::NOT_CONFIGURED) {
+        if (force) Serial.println("OTA not configured: set GITHUB_OWNER and GITHUB_REPO constants");
+        return false;
+    }
+    if (isBusy()) return false;
+    _force.store(force);
+    _requested.store(true);
+    return true;
+}
+
+void OtaUpdater::taskMain(void* arg) {
+    OtaUpdater* self = static_cast<OtaUpdater*>(arg);
+    for (;;) {
+        if (self->_requested.load()) {
+            self->run(self->_force.load());
+            self->_requested.store(false);
+        }
+        delay(IDLE_POLL_MS);
+    }
+}
+
+void OtaUpdater::run(bool force) {
+    if (WiFi.status() != WL_CONNECTED) {
+        setPhase(Phase::FAILED);
+        return;
+    }
+
+    setPhase(Phase::CHECKING);
+    char remoteVersion[32];
+    if (!fetchRemoteVersion(remoteVersion, sizeof(remoteVersion))) {
+        if (force) Serial.println("OTA check failed: could not fetch version.txt from GitHub");
+        setPhase(Phase::FAILED);
+        return;
+    }
+
+    Serial.printf("OTA check local=%s remote=%s\n", _localVersion, remoteVersion);
+    if (!OtaVersion::isNewer(remoteVersion, _localVersion)) {
+        if (force) Serial.println("OTA: already at latest firmware");
+        setPhase(Phase::UP_TO_DATE);
+        return;
+    }
+
+    setPhase(Phase::DOWNLOADING);
+    if (!download()) {
+        setPhase(Phase::FAILED);
+        return;
+    }
+
+    setPhase(Phase::REBOOTING);
+    Serial.println("OTA: update successful, rebooting...");
+    delay(200);
+    ESP.restart();
+}
+
+bool OtaUpdater::fetchRemoteVersion(char* out, size_t outLen) {
+    WiFiClientSecure httpsClient;
+    httpsClient.setInsecure();
+
+    HTTPClient http;
+    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+    http.setConnectTimeout(CONNECT_TIMEOUT_MS);
+    if (!http.begin(httpsClient, assetUrl("version.txt"))) {
+        return false;
+    }
+
+    http.setUserAgent("esp32-rgb-ota");
+    if (http.GET() != HTTP_CODE_OK) {
+        http.end();
+        return false;
+    }
+
+    String body = http.getString();
+    http.end();
+    body.trim();
+    if (body.length() == 0) return false;
+    strlcpy(out, body.c_str(), outLen);
+    return true;
+}
+
+bool OtaUpdater::download() {
+    WiFiClientSecure updateClient;
+    updateClient.setInsecure();
+
+    String url = assetUrl("firmware.bin");
+    Serial.printf("OTA: downloading %s\n", url.c_str());
+
+    HTTPClient http;
+    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+    http.setConnectTimeout(CONNECT_TIMEOUT_MS);
+    if (!http.begin(updateClient, url)) {
+        return false;
+    }
+    http.setUserAgent("esp32-rgb-ota");
+    int status = http.GET();
+    if (status != HTTP_CODE_OK) {
+        Serial.printf("OTA failed: HTTP %d\n", status);
+        http.end();
+        return false;
+    }
+
+    int size = http.getSize();
+    HttpBodySource source(http.getStreamPtr());
+    UpdatePartitionSink sink;
+    OtaStream stream;
+    _percent.store(0);
+
+    if (stream.begin(&source, &sink, size > 0 ? (size_t)size : 0, millis())) {
+        uint8_t reported = 0;
+        while (stream.step(millis()) == OtaStream::State::STREAMING) {
+            _percent.store(stream.percent());
+            if (stream.percent() >= reported + 10) {
+                reported = stream.percent() - stream.percent() % 10;
+                Serial.printf("OTA: %u%% (%u bytes)\n", reported, (unsigned)stream.bytesDone());
+            }
+            // Give the WiFi stack and anything else on this core a turn between chunks
+            delay(1);
+        }
+    }
+    http.end();
+
+    if (stream.state() != OtaStream::State::DONE) {
+        Serial.printf("OTA failed after %u bytes: %s (Update error %u)\n", (unsigned)stream.bytesDone(),
+                      OtaStream::errorName(stream.error()), Update.getError());
+        return false;
+    }
+    _percent.store(100);
+    return true;
+}
+
+String OtaUpdater::assetUrl(const char* assetName) const {
+    String url = "https://github.com/";
+    url += _owner;
+    url += "/";
+    url += _repo;
+    url += "/releases/latest/download/";
+    url += assetName;
+    return url;
+}
+
+const char* OtaUpdater::phaseName(Phase phase) {
+    switch (phase) {
+        case Phase::IDLE: return "idle";
+        case Phase::CHECKING: return "checking";
+        case Phase::DOWNLOADING: return "downloading";
+        case Phase::REBOOTING: return "rebooting";
+        case Phase::UP_TO_DATE: return "up to date";
+        case Phase::FAILED: return "failed";
+        case Phase::NOT_CONFIGURED: return "not configured";
+    }
+    return "?";
+}
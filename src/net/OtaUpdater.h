@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "core/PinnedTask.h"
+
+/**
+ * OtaUpdater - GitHub release OTA in a background task (firmware only).
+ *
+ * request() only raises a flag, so the network task and the render task
+ * never wait on HTTPS. The OTA task then fetches version.txt, and when the
+ * release is newer streams firmware.bin into the update partition through
+ * OtaStream, one bounded chunk per step, yielding between chunks and
+ * publishing progress. The only user-visible pause is the reboot into the
+ * new image.
+ */
+class OtaUpdater {
+public:
+    enum class Phase : uint8_t {
+        IDLE,
+        CHECKING,
+        DOWNLOADING,
+        REBOOTING,
+        UP_TO_DATE,
+        FAILED,
+        NOT_CONFIGURED
+    };
+
+    // owner/repo/localVersion must outlive the updater (string literals)
+    void begin(const char* owner, const char* repo, const char* localVersion, uint8_t core);
+
+    // Queue a check; force also reports "already up to date". False while busy.
+    bool request(bool force);
+
+    Phase phase() const { return (Phase)_phase.load(); }
+    bool isBusy() const;
+    uint8_t percent() const { return _percent.load(); }
+    static const char* phaseName(Phase phase);
+
+private:
+    const char* _owner = "";
+    const char* _repo = "";
+    const char* _localVersion = "";
+    PinnedTask _task;
+    std::atomic<bool> _requested{false};
+    std::atomic<bool> _force{false};
+    std::atomic<uint8_t> _phase{(uint8_t)Phase::IDLE};
+    std::atomic<uint8_t> _percent{0};
+
+    static void taskMain(void* arg);
+    void run(bool force);
+    bool fetchRemoteVersion(char* out, size_t outLen);
+    bool download();
+    String assetUrl(const char* assetName) const;
+    void setPhase(Phase phase) { _phase.store((uint8_t)phase); }
+};
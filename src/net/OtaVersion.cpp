@@ -0,0 +1,33 @@
+#include "OtaVersion.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace OtaVersion {
+
+Version parse(const char* text) {
+    long parts[3] = {0, 0, 0};
+    const char* p = text;
+    for (int i = 0; i < 3 && p != nullptr; i++) {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+        parts[i] = strtol(p, nullptr, 10);
+        const char* dot = strchr(p, '.');
+        p = dot ? dot + 1 : nullptr;
+    }
+
+    Version v;
+    v.major = parts[0];
+    v.minor = parts[1];
+    v.patch = parts[2];
+    return v;
+}
+
+bool isNewer(const char* remote, const char* local) {
+    Version r = parse(remote);
+    Version l = parse(local);
+    if (r.major != l.major) return r.major > l.major;
+    if (r.minor != l.minor) return r.minor > l.minor;
+    return r.patch > l.patch;
+}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * OtaVersion - "major.minor.patch" parsing and comparison for the OTA check.
+ *
+ * Parts are read like String::toInt(): surrounding whitespace is skipped and
+ * anything that is not a number counts as 0, so "1.4", " 1.4.0\n" and
+ * "1.4.0" compare equal. Plain C strings, so it runs on the host too.
+ */
+namespace OtaVersion {
+    struct Version {
+        long major = 0;
+        long minor = 0;
+        long patch = 0;
+    };
+
+    Version parse(const char* text);
+
+    // True only when remote is strictly newer than local
+    bool isNewer(const char* remote, const char* local);
+}
@@ -0,0 +1,60 @@
+#include "Reconnector.h"
+
+Reconnector::Reconnector(uint32_t attemptTimeoutMs, uint32_t minBackoffMs, uint32_t maxBackoffMs)
+    : _attemptTimeoutMs(attemptTimeoutMs),
+      _minBackoffMs(minBackoffMs),
+      _maxBackoffMs(maxBackoffMs < minBackoffMs ? minBackoffMs : maxBackoffMs),
+      _backoffMs(minBackoffMs) {}
+
+Reconnector::Action Reconnector::tick(uint32_t now, bool connected, bool canAttempt) {
+    if (connected) {
+        if (_state != State::CONNECTED) {
+            if (_state != State::IDLE) _downTotalMs += now - _downSinceMs;
+            _connects++;
+            _backoffMs = _minBackoffMs;
+            _state = State::CONNECTED;
+        }
+        return Action::NONE;
+    }
+
+    switch (_state) {
+        case State::IDLE:
+        case State::CONNECTED:
+            // Link lost (or never up): try straight away, back off only if that fails
+            if (_state == State::CONNECTED) _drops++;
+            _downSinceMs = now;
+            _retryAtMs = now;
+            _state = State::BACKOFF;
+            return canAttempt ? beginAttempt(now) : Action::NONE;
+
+        case State::CONNECTING:
+            if (now - _attemptStartMs < _attemptTimeoutMs) return Action::NONE;
+            _retryAtMs = now + _backoffMs;
+            _backoffMs = _backoffMs >= _maxBackoffMs / 2 ? _maxBackoffMs : _backoffMs * 2;
+            _state = State::BACKOFF;
+            return Action::ABANDON_ATTEMPT;
+
+        case State::BACKOFF:
+            if (!canAttempt || (int32_t)(now - _retryAtMs) < 0) return Action::NONE;
+            return beginAttempt(now);
+    }
+    return Action::NONE;
+}
+
+Reconnector::Action Reconnector::beginAttempt(uint32_t now) {
+    _attempts++;
+    _attemptStartMs = now;
+    _state = State::CONNECTING;
+    return Action::BEGIN_ATTEMPT;
+}
+
+Reconnector::Stats Reconnector::stats(uint32_t now) const {
+    Stats s;
+    s.attempts = _attempts;
+    s.connects = _connects;
+    s.drops = _drops;
+    s.downMs = _downTotalMs;
+    if (_state != State::CONNECTED && _state != State::IDLE) s.downMs += now - _downSinceMs;
+    s.backoffMs = _backoffMs;
+    return s;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Reconnector - non-blocking reconnect policy for one network link.
+ *
+ * The caller reports whether the link is up once per loop pass; tick() says
+ * when to start a connection attempt and when to abandon one that has not
+ * come up within the attempt timeout. Failed attempts back off
+ * exponentially (doubling from minBackoffMs up to maxBackoffMs) and the
+ * backoff resets once the link is up. Nothing here waits, so a dead access
+ * point or broker costs one cheap tick per pass instead of seconds of
+ * delay().
+ *
+ * The policy has no WiFi/MQTT dependencies, so it builds and runs on the
+ * host as well.
+ */
+class Reconnector {
+public:
+    enum class State : uint8_t {
+        IDLE,         // not ticked yet
+        CONNECTED,
+        CONNECTING,   // attempt in flight
+        BACKOFF       // waiting before the next attempt
+    };
+
+    enum class Action : uint8_t {
+        NONE,
+        BEGIN_ATTEMPT,   // start connecting now
+        ABANDON_ATTEMPT  // the current attempt timed out; tear it down
+    };
+
+    struct Stats {
+        uint32_t attempts = 0;        // connection attempts started
+        uint32_t connects = 0;        // attempts (or auto-reconnects) that came up
+        uint32_t drops = 0;           // connected -> disconnected transitions
+        uint32_t downMs = 0;          // total time not connected, including now
+        uint32_t backoffMs = 0;       // wait before the next attempt after a failure
+    };
+
+    // attemptTimeoutMs of 0 suits blocking connect() calls: the result is
+    // already known on the next tick
+    Reconnector(uint32_t attemptTimeoutMs, uint32_t minBackoffMs, uint32_t maxBackoffMs);
+
+    // canAttempt=false records state changes without starting attempts (e.g.
+    // MQTT while WiFi is down); the first pass it is true may attempt at once
+    Action tick(uint32_t now, bool connected, bool canAttempt = true);
+
+    State state() const { return _state; }
+    bool isConnected() const { return _state == State::CONNECTED; }
+    Stats stats(uint32_t now) const;
+
+private:
+    uint32_t _attemptTimeoutMs;
+    uint32_t _minBackoffMs;
+    uint32_t _maxBackoffMs;
+
+    State _state = State::IDLE;
+    uint32_t _backoffMs;
+    uint32_t _attemptStartMs = 0;
+    uint32_t _retryAtMs = 0;
+    uint32_t _downSinceMs = 0;
+
+    uint32_t _attempts = 0;
+    uint32_t _connects = 0;
+    uint32_t _drops = 0;
+    uint32_t _downTotalMs = 0;
+
+    Action beginAttempt(uint32_t now);
+};
@@ -0,0 +1,225 @@
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "animations/AnimationRegistry.h"
+#include "animations/StreamedAnimation.h"
+#include "core/Command.h"
+#include "display/CountingDisplay.h"
+#include "display/SimulatedDisplay.h"
+
+/**
+ * Render bench: `program [--seconds N] [--fps N] [--budget-us N] [--format csv|json] [animation|FILE:<name> ...]`
+ *
+ * Runs each registered animation (or the ones named) for N seconds of
+ * virtual time (SimClock) and times every update() + render() on the host
+ * clock. Per animation it reports mean, p50, p99 and max frame time, plus
+ * IDisplay calls, pixel writes and overdraw per frame, as CSV (default) or
+ * JSON on stdout. Frames are timed against the bare display; the counts
+ * come from a second, untimed pass through CountingDisplay. With a budget
+ * set, frames over it are counted and the exit code is 2 if any animation
+ * had one. The streamed player needs FILE:<name>; the registry's bare
+ * "file" entry is skipped.
+ */
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    uint32_t seconds = 10;
+    uint16_t fps = 0;           // 0: the animation's own targetFps()
+    uint32_t budgetUs = 0;      // 0: no budget
+    bool json = false;
+    std::vector<std::string> names;
+};
+
+struct Result {
+    std::string name;
+    uint16_t fps = 0;
+    uint32_t frames = 0;
+    double meanUs = 0;
+    double p50Us = 0;
+    double p99Us = 0;
+    double maxUs = 0;
+    double callsPerFrame = 0;
+    double pixelsPerFrame = 0;
+    double overdraw = 0;        // mean writes per touched pixel
+    uint8_t maxWrites = 0;      // most writes to one pixel in any frame
+    uint32_t overBudget = 0;
+};
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.rfind("--", 0) != 0) {
+            options.names.push_back(arg);
+            continue;
+        }
+        if (i + 1 >= argc) return false;
+        std::string value = argv[++i];
+        long number = std::strtol(value.c_str(), nullptr, 10);
+        if (arg == "--seconds" && number > 0) options.seconds = (uint32_t)number;
+        else if (arg == "--fps" && number >= 0 && number <= 1000) options.fps = (uint16_t)number;
+        else if (arg == "--budget-us" && number >= 0) options.budgetUs = (uint32_t)number;
+        else if (arg == "--format" && (value == "csv" || value == "json")) options.json = value == "json";
+        else return false;
+    }
+    return true;
+}
+
+// Nearest-rank percentile of sorted samples
+double percentile(const std::vector<double>& sorted, uint32_t pct) {
+    size_t rank = (sorted.size() * pct + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+// Start the animation on display at virtual time 0 with a fixed seed, so every pass sees the same frames
+bool startOn(IAnimation& animation, IDisplay& display) {
+    animation.init(&display);
+    SimClock::setMs(0);
+    std::srand(12345);
+    animation.start();
+    return animation.isRunning();
+}
+
+bool measure(IAnimation& animation, const std::string& name, const Options& options, Result& result) {
+    // Timing pass against the bare panel, so the figures leave out CountingDisplay's bookkeeping
+    SimulatedDisplay panel(64, 64, 1);
+    if (!startOn(animation, panel)) return false;
+
+    result.name = name;
+    result.fps = options.fps ? options.fps : animation.targetFps();
+    result.frames = options.seconds * result.fps;
+    int64_t periodUs = 1000000 / result.fps;
+
+    std::vector<double> samples;
+    samples.reserve(result.frames);
+    for (uint32_t frame = 0; frame < result.frames; frame++) {
+        // One-shot animations start over, outside the timed region
+        if (!animation.isRunning()) animation.start();
+        auto start = Clock::now();
+        animation.update();
+        animation.render();
+        double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        samples.push_back(us);
+        if (options.budgetUs && us > options.budgetUs) result.overBudget++;
+        SimClock::advanceUs(periodUs);
+    }
+    animation.stop();
+
+    // Counting pass: the same frames again through CountingDisplay, untimed
+    CountingDisplay display(panel);
+    startOn(animation, display);
+    uint64_t calls = 0;
+    uint64_t pixels = 0;
+    uint64_t touched = 0;
+    for (uint32_t frame = 0; frame < result.frames; frame++) {
+        if (!animation.isRunning()) animation.start();
+        animation.update();
+        animation.render();
+        display.endFrame();
+        const CountingDisplay::FrameStats& stats = display.lastFrame();
+        calls += stats.totalCalls();
+        pixels += stats.pixelWrites;
+        touched += stats.pixelsTouched;
+        if (stats.maxWrites > result.maxWrites) result.maxWrites = stats.maxWrites;
+        SimClock::advanceUs(periodUs);
+    }
+    animation.stop();
+
+    double total = 0;
+    for (double us : samples) total += us;
+    std::sort(samples.begin(), samples.end());
+    result.meanUs = total / samples.size();
+    result.p50Us = percentile(samples, 50);
+    result.p99Us = percentile(samples, 99);
+    result.maxUs = samples.back();
+    result.callsPerFrame = (double)calls / result.frames;
+    result.pixelsPerFrame = (double)pixels / result.frames;
+    result.overdraw = touched ? (double)pixels / touched : 0.0;
+    return true;
+}
+
+void printCsv(const std::vector<Result>& results) {
+    std::printf("animation,fps,frames,mean_us,p50_us,p99_us,max_us,calls_per_frame,pixels_per_frame,overdraw,max_writes,"
+                "over_budget\n");
+    for (const Result& r : results) {
+        std::printf("%s,%u,%u,%.2f,%.2f,%.2f,%.2f,%.1f,%.1f,%.2f,%u,%u\n", r.name.c_str(), r.fps, r.frames, r.meanUs,
+                    r.p50Us, r.p99Us, r.maxUs, r.callsPerFrame, r.pixelsPerFrame, r.overdraw, r.maxWrites, r.overBudget);
+    }
+}
+
+void printJson(const std::vector<Result>& results, const Options& options) {
+    std::printf("{\n  \"seconds\": %u,\n  \"budget_us\": %u,\n  \"animations\": [", options.seconds, options.budgetUs);
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        std::printf("%s\n    {\"name\": \"%s\", \"fps\": %u, \"frames\": %u, \"mean_us\": %.2f, \"p50_us\": %.2f, "
+                    "\"p99_us\": %.2f, \"max_us\": %.2f, \"calls_per_frame\": %.1f, \"pixels_per_frame\": %.1f, "
+                    "\"overdraw\": %.2f, \"max_writes\": %u, \"over_budget\": %u}",
+                    i ? "," : "", r.name.c_str(), r.fps, r.frames, r.meanUs, r.p50Us, r.p99Us, r.maxUs,
+                    r.callsPerFrame, r.pixelsPerFrame, r.overdraw, r.maxWrites, r.overBudget);
+    }
+    std::printf("\n  ]\n}\n");
+}
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr,
+                     "usage: %s [--seconds N] [--fps N] [--budget-us N] [--format csv|json] [animation|FILE:<name> ...]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    // What to run: every registry entry but the bare file player, or the named ones resolved like a command
+    struct Target {
+        int index;
+        std::string name;
+    };
+    std::vector<Target> targets;
+    if (options.names.empty()) {
+        for (uint8_t i = 0; i < AnimationRegistry::count(); i++) {
+            if (i != AnimationRegistry::named("file")) targets.push_back({i, AnimationRegistry::entry(i).name});
+        }
+    }
+    for (const std::string& name : options.names) {
+        Command command = Command::parse(name.c_str(), name.size());
+        if (command.id == CommandId::ANIMATION) {
+            targets.push_back({command.animation, AnimationRegistry::entry(command.animation).name});
+        } else if (command.id == CommandId::PLAY_FILE) {
+            streamedAnimation.setFile(command.text, command.length);
+            targets.push_back({AnimationRegistry::named("file"), std::string("file:") + streamedAnimation.fileName()});
+        } else {
+            std::fprintf(stderr, "unknown animation: %s\n", name.c_str());
+            return 1;
+        }
+    }
+
+    std::vector<Result> results;
+    for (const Target& target : targets) {
+        Result result;
+        if (!measure(AnimationRegistry::entry((uint8_t)target.index).instance(), target.name, options, result)) {
+            std::fprintf(stderr, "%s does not start, skipped\n", target.name.c_str());
+            continue;
+        }
+        results.push_back(result);
+    }
+    SimClock::useRealTime();
+
+    if (options.json) printJson(results, options);
+    else printCsv(results);
+
+    for (const Result& result : results) {
+        if (result.overBudget) {
+            std::fprintf(stderr, "%s: %u of %u frames over %u us\n", result.name.c_str(), result.overBudget,
+                         result.frames, options.budgetUs);
+        }
+    }
+    bool failed = std::any_of(results.begin(), results.end(), [](const Result& r) { return r.overBudget > 0; });
+    return failed ? 2 : 0;
+}
@@ -1,104 +1,205 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <filesystem>
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
-#include "animations/EggChickAnimation.h"
-#include "animations/ValentineHeartbeat.h"
-#include "animations/ValentineTwoHearts.h"
-#include "animations/ValentineLoveLetter.h"
-#include "animations/ValentineTextOnly.h"
-#include "animations/ValentineTextChick.h"
-#include "animations/Chick1Animation.h"
-#include "animations/Mosq1Animation.h"
+#include "animations/AnimationRegistry.h"
+#include "animations/StreamedAnimation.h"
 #include "display/SimulatedDisplay.h"
+#include "core/FrameScheduler.h"
+#include "core/SpscQueue.h"
+#include "core/Command.h"
+#include "core/PinnedTask.h"
+
+namespace {
+// Registry index a command starts, or NOT_FOUND; FILE:<name> selects the streamed player
+int animationFor(const Command& command, std::string& prefix) {
+    if (command.id == CommandId::ANIMATION) {
+        prefix = AnimationRegistry::entry(command.animation).name;
+        return command.animation;
+    }
+    if (command.id == CommandId::PLAY_FILE) {
+        streamedAnimation.setFile(command.text, command.length);
+        prefix = streamedAnimation.fileName();
+        return AnimationRegistry::named("file");
+    }
+    return AnimationRegistry::NOT_FOUND;
+}
+
+struct Options {
+    int frames = 240;
+    uint16_t fps = 30;          // render and capture rate; 0: the animation's own targetFps()
+    int every = 3;              // write every Nth frame
+    uint32_t switchMs = 1000;   // spacing of the scripted commands
+    bool realtime = false;      // pace on the host clock instead of virtual time
+    std::vector<std::string> names;
+};
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program
+              << " [--frames N] [--fps N] [--every N] [--switch-ms N] [--realtime] [animation|FILE:<name> ...]\n"
+              << "  Renders the first animation, switching to each following one every --switch-ms.\n"
+              << "  Time is virtual unless --realtime: frames render as fast as possible and every run is identical."
+              << std::endl;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--realtime") {
+            options.realtime = true;
+            continue;
+        }
+        if (arg.rfind("--", 0) != 0) {
+            options.names.push_back(arg);
+            continue;
+        }
+        if (i + 1 >= argc) return false;
+        long value = std::strtol(argv[++i], nullptr, 10);
+        if (arg == "--frames" && value > 0) options.frames = (int)value;
+        else if (arg == "--fps" && value >= 0 && value <= 1000) options.fps = (uint16_t)value;
+        else if (arg == "--every" && value > 0) options.every = (int)value;
+        else if (arg == "--switch-ms" && value > 0) options.switchMs = (uint32_t)value;
+        else return false;
+    }
+    return true;
+}
+
+// Stand-in for the firmware's network task in --realtime runs: posts the
+// scripted commands on the host clock until the frame loop sets stop
+struct CommandFeed {
+    SpscQueue<Command, 8>* queue;
+    std::vector<std::string> commands;
+    uint32_t intervalMs;
+    std::atomic<bool> stop{false};
+};
+
+void feedCommands(void* arg) {
+    CommandFeed* feed = static_cast<CommandFeed*>(arg);
+    for (const std::string& text : feed->commands) {
+        uint32_t due = millis() + feed->intervalMs;
+        while (!feed->stop && (int32_t)(millis() - due) < 0) delay(1);
+        Command command = Command::parse(text.c_str(), text.size());
+        // Nobody pops once the frame loop is done; drop the rest
+        while (!feed->stop && !feed->queue->push(command)) delay(1);
+        if (feed->stop) return;
+    }
+}
+}
 
 int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
     std::srand(12345);
+    if (!options.realtime) SimClock::setMs(0);
+    auto wallStart = std::chrono::steady_clock::now();
 
     SimulatedDisplay display(64, 64, 8);
 
-    eggChickAnimation.init(&display);
-    valentineHeartbeat.init(&display);
-    valentineTwoHearts.init(&display);
-    valentineLoveLetter.init(&display);
-    valentineTextOnly.init(&display);
-    valentineTextChick.init(&display);
-    chick1Animation.init(&display);
-    mosq1Animation.init(&display);
-
-    std::string anim = "val4";
-    if (argc > 1 && argv[1] != nullptr) {
-        anim = argv[1];
-    }
+    animationRegistry.initAll(&display);
 
-    std::string prefix;
+    std::string anim = options.names.empty() ? "val4" : options.names[0];
 
-    if (anim == "val1") {
-        valentineHeartbeat.start();
-        prefix = "val1";
-    } else if (anim == "val2") {
-        valentineTwoHearts.start();
-        prefix = "val2";
-    } else if (anim == "val3") {
-        valentineLoveLetter.start();
-        prefix = "val3";
-    } else if (anim == "egg") {
-        eggChickAnimation.start();
-        prefix = "egg";
-    } else if (anim == "val5") {
-        valentineTextChick.start();
-        prefix = "val5";
-    } else if (anim == "chick1") {
-        chick1Animation.start();
-        prefix = "chick1";
-    } else if (anim == "mosq1") {
-        mosq1Animation.start();
-        prefix = "mosq1";
-    } else {
-        valentineTextOnly.start();
-        prefix = "val4";
+    std::string prefix;
+    int index = animationFor(Command::parse(anim.c_str(), anim.size()), prefix);
+    IAnimation* active = index != AnimationRegistry::NOT_FOUND ? animationRegistry.start((uint8_t)index) : nullptr;
+    if (active == nullptr || !active->isRunning()) {
+        std::cout << "Cannot start " << anim << ", playing val4" << std::endl;
+        active = animationRegistry.start((uint8_t)animationFor(Command::parse("val4", 4), prefix));
     }
-
     std::filesystem::create_directories("sim_frames");
 
-    const int totalFrames = 240;
-    const int writeEvery = 3;
-
-    for (int frame = 0; frame < totalFrames; frame++) {
-        if (prefix == "val1") {
-            valentineHeartbeat.update();
-            valentineHeartbeat.render();
-        } else if (prefix == "val2") {
-            valentineTwoHearts.update();
-            valentineTwoHearts.render();
-        } else if (prefix == "val3") {
-            valentineLoveLetter.update();
-            valentineLoveLetter.render();
-        } else if (prefix == "egg") {
-            eggChickAnimation.update();
-            eggChickAnimation.render();
-        } else if (prefix == "val5") {
-            valentineTextChick.update();
-            valentineTextChick.render();
-        } else if (prefix == "chick1") {
-            chick1Animation.update();
-            chick1Animation.render();
-        } else if (prefix == "mosq1") {
-            mosq1Animation.update();
-            mosq1Animation.render();
-        } else {
-            valentineTextOnly.update();
-            valentineTextOnly.render();
+    // Frames come at the capture rate sim/ppm_to_gif.py assumes; update steps stay at the
+    // animation's own rate, so frame players keep their speed
+    auto rateFor = [&](IAnimation* animation) { return options.fps ? options.fps : animation->targetFps(); };
+
+    // Same pacing as the firmware loop, on the virtual or host clock
+    FrameScheduler scheduler(rateFor(active), active->targetFps());
+
+    // Any further names are animations (or FILE:<name>) switched to over time
+    SpscQueue<Command, 8> commands;
+    std::vector<std::string> script(options.names.size() > 1 ? options.names.begin() + 1 : options.names.end(),
+                                    options.names.end());
+    CommandFeed feed{&commands, script, options.switchMs};
+    PinnedTask network;
+    if (options.realtime) network.start("network", feedCommands, &feed, 0);
+    size_t scripted = 0;
+    uint32_t startMs = millis();
+
+    for (int frame = 0; frame < options.frames; frame++) {
+        uint8_t steps = scheduler.waitForFrame();
+
+        // Virtual time: deliver each scripted command on the frame that crosses its mark
+        while (!options.realtime && scripted < script.size() &&
+               millis() - startMs >= (scripted + 1) * options.switchMs) {
+            const std::string& text = script[scripted++];
+            commands.push(Command::parse(text.c_str(), text.size()));
+        }
+
+        Command command;
+        while (commands.pop(command)) {
+            // Like the firmware: check a file before stopping what is playing
+            if (command.id == CommandId::PLAY_FILE && !streamedAnimation.canPlay(command.text, command.length)) {
+                std::cout << "Cannot start " << std::string(command.text, command.length) << ", keeping " << prefix
+                          << std::endl;
+                continue;
+            }
+            std::string nextPrefix;
+            int next = animationFor(command, nextPrefix);
+            if (next == AnimationRegistry::NOT_FOUND) {
+                std::cout << "Unknown animation: " << command.text << std::endl;
+                continue;
+            }
+            int previous = animationRegistry.activeIndex();
+            IAnimation* started = animationRegistry.start((uint8_t)next);
+            if (!started->isRunning()) {
+                // Failed after stopping the previous animation; start that again from its first frame
+                std::cout << "Cannot start " << nextPrefix << ", restarting " << prefix << std::endl;
+                if (previous == AnimationRegistry::named("file")) {
+                    streamedAnimation.setFile(prefix.c_str(), prefix.size());
+                }
+                active = animationRegistry.start((uint8_t)previous);
+                if (!active->isRunning()) {
+                    active = animationRegistry.start((uint8_t)animationFor(Command::parse("val4", 4), prefix));
+                }
+            } else {
+                prefix = nextPrefix;
+                active = started;
+            }
+            scheduler.setRate(rateFor(active), active->targetFps());
         }
+        for (uint8_t i = 0; i < steps; i++) {
+            active->update();
+        }
+        active->render();
 
-        if (frame % writeEvery == 0) {
+        if (frame % options.every == 0) {
             std::ostringstream name;
             name << "sim_frames/" << prefix << "_" << std::setfill('0') << std::setw(4) << frame << ".ppm";
             display.saveFramePPM(name.str());
         }
+    }
 
-        delay(33);
+    if (options.realtime) {
+        feed.stop = true;
+        network.join();
+
+        FrameScheduler::Stats pacing = scheduler.stats();
+        std::cout << "Paced at " << scheduler.targetFps() << " fps target: achieved " << std::fixed << std::setprecision(1)
+                  << pacing.fps << " fps, jitter avg " << pacing.jitterAvgUs << " us, max " << pacing.jitterMaxUs
+                  << " us, " << pacing.lateFrames << " late frames" << std::endl;
+    } else {
+        auto wallMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wallStart);
+        std::cout << "Rendered " << options.frames << " frames (" << std::fixed << std::setprecision(2)
+                  << (millis() - startMs) / 1000.0f << " s virtual) in " << wallMs.count() << " ms" << std::endl;
     }
 
     std::cout << "Simulation complete for " << prefix << ". Frames written to ./sim_frames (PPM format)." << std::endl;